@@ -0,0 +1,184 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/AggregateProxySource.h"
+#include "datasource/ArraySource.h"
+#include "datasource/ModelSource.h"
+
+class AggregateProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        // Basic creation should create an empty source.
+        auto source = std::make_unique<AggregateProxySource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+        QCOMPARE(source->source(), nullptr);
+    }
+
+    void testAggregate_data()
+    {
+        QTest::addColumn<AggregateProxySource::Aggregation>("aggregation");
+        QTest::addColumn<QVariantList>("expected");
+
+        // Items 0 to 24 in buckets of 10 items.
+        QTest::newRow("average") << AggregateProxySource::Average << QVariantList{4.5, 14.5, 22.0};
+        QTest::newRow("minimum") << AggregateProxySource::Minimum << QVariantList{0.0, 10.0, 20.0};
+        QTest::newRow("maximum") << AggregateProxySource::Maximum << QVariantList{9.0, 19.0, 24.0};
+        QTest::newRow("sum") << AggregateProxySource::Sum << QVariantList{45.0, 145.0, 110.0};
+        QTest::newRow("last") << AggregateProxySource::Last << QVariantList{9.0, 19.0, 24.0};
+        QTest::newRow("count") << AggregateProxySource::Count << QVariantList{10.0, 10.0, 5.0};
+    }
+
+    void testAggregate()
+    {
+        QVariantList array;
+        for (int i = 0; i < 25; ++i) {
+            array.append(i);
+        }
+
+        auto arraySource = std::make_unique<ArraySource>();
+        arraySource->setArray(array);
+
+        QFETCH(AggregateProxySource::Aggregation, aggregation);
+        QFETCH(QVariantList, expected);
+
+        auto source = std::make_unique<AggregateProxySource>();
+        source->setSource(arraySource.get());
+        source->setAggregation(aggregation);
+
+        QCOMPARE(source->itemCount(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(source->item(i).toDouble(), expected.at(i).toDouble());
+        }
+        QCOMPARE(source->item(expected.size()), QVariant{});
+    }
+
+    void testBucketCount()
+    {
+        QVariantList array;
+        for (int i = 0; i < 25; ++i) {
+            array.append(i);
+        }
+
+        auto arraySource = std::make_unique<ArraySource>();
+        arraySource->setArray(array);
+
+        auto source = std::make_unique<AggregateProxySource>();
+        source->setSource(arraySource.get());
+        source->setAggregation(AggregateProxySource::Sum);
+        source->setBucketCount(3);
+
+        // 25 items fit in 3 buckets of 9 items.
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(0).toDouble(), 36.0);
+        QCOMPARE(source->item(1).toDouble(), 117.0);
+        QCOMPARE(source->item(2).toDouble(), 147.0);
+
+        // The bucket size follows the number of items of the source.
+        array.append(25);
+        array.append(26);
+        arraySource->setArray(array);
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(0).toDouble(), 36.0);
+        QCOMPARE(source->item(2).toDouble(), 198.0);
+
+        // Without a bucket count, bucketSize is used again.
+        source->setBucketCount(0);
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(2).toDouble(), 161.0);
+    }
+
+    void testAppendExtremes()
+    {
+        QStandardItemModel model;
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto source = std::make_unique<AggregateProxySource>();
+        source->setSource(modelSource.get());
+        source->setBucketSize(3);
+        source->setAggregation(AggregateProxySource::Average);
+
+        // The averages of the last bucket go up and down while items are
+        // appended, so its old value is often the minimum or maximum.
+        const QList<int> values = {5, 20, -10, 0, 30, -5, 2, 2, 2, 50, -40, 1};
+        for (auto value : values) {
+            model.appendRow(new QStandardItem{QString::number(value)});
+
+            AggregateProxySource reference;
+            reference.setSource(modelSource.get());
+            reference.setBucketSize(3);
+            reference.setAggregation(AggregateProxySource::Average);
+
+            QCOMPARE(source->minimum(), reference.minimum());
+            QCOMPARE(source->maximum(), reference.maximum());
+        }
+    }
+
+    void testAppend()
+    {
+        QStandardItemModel model;
+        for (int i = 0; i < 7; ++i) {
+            model.appendRow(new QStandardItem{QString::number(i)});
+        }
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto source = std::make_unique<AggregateProxySource>();
+        source->setSource(modelSource.get());
+        source->setBucketSize(4);
+        source->setAggregation(AggregateProxySource::Sum);
+
+        QSignalSpy appendedSpy{source.get(), &ChartDataSource::itemsAppended};
+
+        for (int i = 7; i < 100; ++i) {
+            const auto previousCount = source->itemCount();
+            model.appendRow(new QStandardItem{QString::number(i)});
+
+            // Incrementally updated buckets should match recalculated ones.
+            AggregateProxySource reference;
+            reference.setSource(modelSource.get());
+            reference.setBucketSize(4);
+            reference.setAggregation(AggregateProxySource::Sum);
+
+            QCOMPARE(source->itemCount(), reference.itemCount());
+            for (int item = 0; item < source->itemCount(); ++item) {
+                QCOMPARE(source->item(item), reference.item(item));
+            }
+            QCOMPARE(source->minimum(), reference.minimum());
+            QCOMPARE(source->maximum(), reference.maximum());
+
+            // Only adding a new bucket should be reported as appending items.
+            if (i % 4 == 0) {
+                QCOMPARE(appendedSpy.count(), 1);
+                QCOMPARE(appendedSpy.at(0).at(0).toInt(), previousCount);
+            } else {
+                QCOMPARE(appendedSpy.count(), 0);
+            }
+            appendedSpy.clear();
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(AggregateProxySourceTest)
+
+#include "AggregateProxySourceTest.moc"
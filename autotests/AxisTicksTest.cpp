@@ -0,0 +1,123 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <cmath>
+
+#include <QTest>
+
+#include "AxisTicks.h"
+
+Q_DECLARE_METATYPE(AxisTicks::Unit)
+
+class AxisTicksTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testNiceStep_data()
+    {
+        QTest::addColumn<qreal>("minimumStep");
+        QTest::addColumn<AxisTicks::Unit>("unit");
+        QTest::addColumn<qreal>("expected");
+
+        QTest::newRow("exact") << 1.0 << AxisTicks::Unit::Number << 1.0;
+        QTest::newRow("two") << 1.5 << AxisTicks::Unit::Number << 2.0;
+        QTest::newRow("five") << 3.0 << AxisTicks::Unit::Number << 5.0;
+        QTest::newRow("ten") << 7.0 << AxisTicks::Unit::Number << 10.0;
+        QTest::newRow("fraction") << 0.013 << AxisTicks::Unit::Number << 0.02;
+        QTest::newRow("large") << 4200.0 << AxisTicks::Unit::Number << 5000.0;
+        QTest::newRow("invalid") << 0.0 << AxisTicks::Unit::Number << 0.0;
+        QTest::newRow("milliseconds") << 300.0 << AxisTicks::Unit::Time << 500.0;
+        QTest::newRow("seconds") << 40'000.0 << AxisTicks::Unit::Time << 60'000.0;
+        QTest::newRow("hours") << 4.0 * 3'600'000.0 << AxisTicks::Unit::Time << 6.0 * 3'600'000.0;
+        QTest::newRow("days") << 9.0 * 86'400'000.0 << AxisTicks::Unit::Time << 10.0 * 86'400'000.0;
+    }
+
+    void testNiceStep()
+    {
+        QFETCH(qreal, minimumStep);
+        QFETCH(AxisTicks::Unit, unit);
+        QFETCH(qreal, expected);
+
+        QCOMPARE(AxisTicks::niceStep(minimumStep, unit), expected);
+    }
+
+    void testMinorStep_data()
+    {
+        QTest::addColumn<qreal>("majorStep");
+        QTest::addColumn<AxisTicks::Unit>("unit");
+        QTest::addColumn<qreal>("expected");
+
+        QTest::newRow("one") << 1.0 << AxisTicks::Unit::Number << 0.2;
+        QTest::newRow("two") << 20.0 << AxisTicks::Unit::Number << 5.0;
+        QTest::newRow("five") << 0.5 << AxisTicks::Unit::Number << 0.1;
+        QTest::newRow("hour") << 3'600'000.0 << AxisTicks::Unit::Time << 900'000.0;
+        QTest::newRow("ten days") << 10.0 * 86'400'000.0 << AxisTicks::Unit::Time << 2.0 * 86'400'000.0;
+    }
+
+    void testMinorStep()
+    {
+        QFETCH(qreal, majorStep);
+        QFETCH(AxisTicks::Unit, unit);
+        QFETCH(qreal, expected);
+
+        QCOMPARE(AxisTicks::minorStepFor(majorStep, unit), expected);
+    }
+
+    void testCalculate_data()
+    {
+        QTest::addColumn<qreal>("start");
+        QTest::addColumn<qreal>("end");
+        QTest::addColumn<int>("maximumCount");
+        QTest::addColumn<QList<qreal>>("major");
+        QTest::addColumn<QList<qreal>>("minor");
+
+        QTest::newRow("simple") << 0.0 << 100.0 << 6 << QList<qreal>{0.0, 20.0, 40.0, 60.0, 80.0, 100.0}
+                                << QList<qreal>{5.0, 10.0, 15.0, 25.0, 30.0, 35.0, 45.0, 50.0, 55.0, 65.0, 70.0, 75.0, 85.0, 90.0, 95.0};
+        QTest::newRow("reversed") << 100.0 << 0.0 << 3 << QList<qreal>{0.0, 50.0, 100.0}
+                                  << QList<qreal>{10.0, 20.0, 30.0, 40.0, 60.0, 70.0, 80.0, 90.0};
+        QTest::newRow("uneven") << 0.3 << 13.7 << 5 << QList<qreal>{5.0, 10.0}
+                                << QList<qreal>{1.0, 2.0, 3.0, 4.0, 6.0, 7.0, 8.0, 9.0, 11.0, 12.0, 13.0};
+        QTest::newRow("negative") << -7.0 << 7.0 << 8 << QList<qreal>{-6.0, -4.0, -2.0, 0.0, 2.0, 4.0, 6.0}
+                                  << QList<qreal>{-7.0, -6.5, -5.5, -5.0, -4.5, -3.5, -3.0, -2.5, -1.5, -1.0, -0.5, 0.5, 1.0, 1.5, 2.5, 3.0, 3.5, 4.5, 5.0, 5.5, 6.5, 7.0};
+        QTest::newRow("fraction") << 0.0 << 0.3 << 4 << QList<qreal>{0.0, 0.1, 0.2, 0.3}
+                                  << QList<qreal>{0.02, 0.04, 0.06, 0.08, 0.12, 0.14, 0.16, 0.18, 0.22, 0.24, 0.26, 0.28};
+        QTest::newRow("empty range") << 5.0 << 5.0 << 3 << QList<qreal>{5.0} << QList<qreal>{};
+        QTest::newRow("no ticks") << 0.0 << 10.0 << 0 << QList<qreal>{} << QList<qreal>{};
+    }
+
+    void testCalculate()
+    {
+        QFETCH(qreal, start);
+        QFETCH(qreal, end);
+        QFETCH(int, maximumCount);
+        QFETCH(QList<qreal>, major);
+        QFETCH(QList<qreal>, minor);
+
+        const auto ticks = AxisTicks::calculate(start, end, maximumCount);
+        QCOMPARE(ticks.major, major);
+        QCOMPARE(ticks.minor, minor);
+    }
+
+    void testCalculateTime()
+    {
+        const auto hour = 3'600'000.0;
+        const auto start = 1'700'000'000'000.0;
+
+        const auto ticks = AxisTicks::calculate(start, start + 24.0 * hour, 5, AxisTicks::Unit::Time);
+        QCOMPARE(ticks.majorStep, 6.0 * hour);
+        QCOMPARE(ticks.minorStep, hour);
+        QCOMPARE(ticks.major.size(), 4);
+        for (auto value : ticks.major) {
+            QCOMPARE(std::fmod(value, 6.0 * hour), 0.0);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(AxisTicksTest)
+
+#include "AxisTicksTest.moc"
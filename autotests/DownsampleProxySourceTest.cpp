@@ -0,0 +1,126 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/DownsampleProxySource.h"
+#include "datasource/ModelSource.h"
+
+class DownsampleProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        // Basic creation should create an empty source.
+        auto source = std::make_unique<DownsampleProxySource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+        QCOMPARE(source->source(), nullptr);
+    }
+
+    void testDownsample_data()
+    {
+        QTest::addColumn<int>("from");
+        QTest::addColumn<int>("to");
+        QTest::addColumn<int>("maximumItemCount");
+        QTest::addColumn<int>("bucketSize");
+        QTest::addColumn<int>("itemCount");
+
+        QTest::newRow("no limit") << 0 << -1 << 0 << 1 << 100;
+        QTest::newRow("fits") << 0 << -1 << 100 << 1 << 100;
+        QTest::newRow("small buckets") << 0 << -1 << 50 << 2 << 50;
+        QTest::newRow("large buckets") << 0 << -1 << 10 << 16 << 7;
+        QTest::newRow("range") << 20 << 40 << 10 << 2 << 10;
+        QTest::newRow("unaligned range") << 5 << 60 << 10 << 8 << 8;
+    }
+
+    void testDownsample()
+    {
+        QVariantList array;
+        for (int i = 0; i < 100; ++i) {
+            array.append(i);
+        }
+
+        auto arraySource = std::make_unique<ArraySource>();
+        arraySource->setArray(array);
+
+        auto source = std::make_unique<DownsampleProxySource>();
+        source->setSource(arraySource.get());
+
+        QFETCH(int, from);
+        QFETCH(int, to);
+        QFETCH(int, maximumItemCount);
+        source->setFrom(from);
+        source->setTo(to);
+        source->setMaximumItemCount(maximumItemCount);
+
+        QFETCH(int, bucketSize);
+        QFETCH(int, itemCount);
+        QCOMPARE(source->bucketSize(), bucketSize);
+        QCOMPARE(source->itemCount(), itemCount);
+
+        const auto firstBucket = std::max(from, 0) / bucketSize;
+        for (int i = 0; i < itemCount; ++i) {
+            const auto start = (firstBucket + i) * bucketSize;
+            const auto end = std::min(start + bucketSize, 100);
+
+            source->setAggregation(DownsampleProxySource::Minimum);
+            QCOMPARE(source->item(i).toDouble(), qreal(start));
+            source->setAggregation(DownsampleProxySource::Maximum);
+            QCOMPARE(source->item(i).toDouble(), qreal(end - 1));
+            source->setAggregation(DownsampleProxySource::Average);
+            QCOMPARE(source->item(i).toDouble(), (start + end - 1) / 2.0);
+        }
+
+        QCOMPARE(source->item(itemCount), QVariant{});
+    }
+
+    void testAppend()
+    {
+        QStandardItemModel model;
+        for (int i = 0; i < 37; ++i) {
+            model.appendRow(new QStandardItem{QString::number(i)});
+        }
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto source = std::make_unique<DownsampleProxySource>();
+        source->setSource(modelSource.get());
+        source->setMaximumItemCount(4);
+        source->setAggregation(DownsampleProxySource::Maximum);
+
+        for (int i = 37; i < 300; ++i) {
+            model.appendRow(new QStandardItem{QString::number(i)});
+
+            // Incrementally updated buckets should match recalculated ones.
+            DownsampleProxySource reference;
+            reference.setSource(modelSource.get());
+            reference.setMaximumItemCount(4);
+            reference.setAggregation(DownsampleProxySource::Maximum);
+
+            QCOMPARE(source->bucketSize(), reference.bucketSize());
+            QCOMPARE(source->itemCount(), reference.itemCount());
+            for (int item = 0; item < source->itemCount(); ++item) {
+                QCOMPARE(source->item(item), reference.item(item));
+            }
+            QCOMPARE(source->maximum(), QVariant{qreal(i)});
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(DownsampleProxySourceTest)
+
+#include "DownsampleProxySourceTest.moc"
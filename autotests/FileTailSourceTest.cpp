@@ -0,0 +1,168 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include "datasource/FileTailSource.h"
+
+class FileTailSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init()
+    {
+        QVERIFY(m_dir.isValid());
+        m_fileName = m_dir.filePath(QStringLiteral("data.csv"));
+        QFile::remove(m_fileName);
+        write(QByteArray{});
+    }
+
+    void testCreate()
+    {
+        auto source = std::make_unique<FileTailSource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+    }
+
+    void testAppend()
+    {
+        write("1,10\n2,20\n");
+
+        auto source = createSource();
+        source->setColumn(1);
+
+        QTRY_COMPARE(source->itemCount(), 2);
+        QCOMPARE(source->item(0).toDouble(), 10.0);
+        QCOMPARE(source->item(1).toDouble(), 20.0);
+
+        write("3,30\n");
+        QTRY_COMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(2).toDouble(), 30.0);
+        QCOMPARE(source->minimum().toDouble(), 10.0);
+        QCOMPARE(source->maximum().toDouble(), 30.0);
+    }
+
+    void testPartialLine()
+    {
+        write("1\n2\n4");
+
+        auto source = createSource();
+
+        QTRY_COMPARE(source->itemCount(), 2);
+
+        // The incomplete line is only read once the rest of it is written.
+        write("0\n5\n");
+        QTRY_COMPARE(source->itemCount(), 4);
+        QCOMPARE(source->item(2).toDouble(), 40.0);
+        QCOMPARE(source->item(3).toDouble(), 5.0);
+    }
+
+    void testLongLine()
+    {
+        write("1\n");
+        write(QByteArray(4 * 1024 * 1024, 'x'));
+        write("\n2\n");
+
+        auto source = createSource();
+
+        // The line without newlines is skipped.
+        QTRY_COMPARE(source->itemCount(), 2);
+        QCOMPARE(source->item(0).toDouble(), 1.0);
+        QCOMPARE(source->item(1).toDouble(), 2.0);
+    }
+
+    void testMaximumHistory()
+    {
+        auto source = createSource();
+        source->setMaximumHistory(3);
+
+        for (int i = 1; i <= 10; ++i) {
+            write(QByteArray::number(i) + '\n');
+            QTRY_COMPARE(source->item(source->itemCount() - 1).toDouble(), qreal(i));
+            QVERIFY(source->itemCount() <= 3);
+        }
+
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(0).toDouble(), 8.0);
+        QCOMPARE(source->item(2).toDouble(), 10.0);
+        QCOMPARE(source->minimum().toDouble(), 8.0);
+        QCOMPARE(source->maximum().toDouble(), 10.0);
+
+        qreal output[3];
+        source->readValues(0, 3, output);
+        QCOMPARE(output[0], 8.0);
+        QCOMPARE(output[2], 10.0);
+    }
+
+    void testTruncate()
+    {
+        write("1\n2\n3\n");
+
+        auto source = createSource();
+        QTRY_COMPARE(source->itemCount(), 3);
+
+        QFile file{m_fileName};
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write("7\n");
+        file.close();
+
+        QTRY_COMPARE(source->itemCount(), 1);
+        QCOMPARE(source->item(0).toDouble(), 7.0);
+    }
+
+    void testReplace()
+    {
+        write("1\n2\n");
+
+        auto source = createSource();
+        QTRY_COMPARE(source->itemCount(), 2);
+
+        // Replace the file with a larger one, like writing a file atomically
+        // would.
+        const auto newFileName = m_dir.filePath(QStringLiteral("new.csv"));
+        QFile file{newFileName};
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("10\n20\n30\n40\n50\n60\n");
+        file.close();
+
+        QVERIFY(QFile::remove(m_fileName));
+        QVERIFY(QFile::rename(newFileName, m_fileName));
+
+        QTRY_COMPARE(source->itemCount(), 6);
+        QCOMPARE(source->item(0).toDouble(), 10.0);
+        QCOMPARE(source->item(5).toDouble(), 60.0);
+    }
+
+private:
+    std::unique_ptr<FileTailSource> createSource()
+    {
+        auto source = std::make_unique<FileTailSource>();
+        source->setInterval(10);
+        source->setFileName(m_fileName);
+        return source;
+    }
+
+    void write(const QByteArray &data)
+    {
+        QFile file{m_fileName};
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Append));
+        file.write(data);
+    }
+
+    QTemporaryDir m_dir;
+    QString m_fileName;
+};
+
+QTEST_GUILESS_MAIN(FileTailSourceTest)
+
+#include "FileTailSourceTest.moc"
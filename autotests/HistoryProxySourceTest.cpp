@@ -172,6 +172,44 @@ private Q_SLOTS:
         }
     }
 
+    void testMaximumAge()
+    {
+        auto valueSource = std::make_unique<SingleValueSource>();
+
+        auto historySource = std::make_unique<HistoryProxySource>();
+        historySource->setSource(valueSource.get());
+        historySource->setMaximumHistory(2);
+        historySource->setMaximumAge(200);
+        historySource->setFillMode(HistoryProxySource::FillFromStart);
+
+        // With a maximum age, maximumHistory and fillMode are ignored.
+        for (int i = 0; i < 5; i++) {
+            valueSource->setValue(i);
+        }
+        QCOMPARE(historySource->itemCount(), 5);
+
+        auto timestamps = historySource->timestampSource();
+        QCOMPARE(timestamps->itemCount(), 5);
+        QCOMPARE(timestamps->item(0), 0);
+        QVERIFY(timestamps->item(4).toLongLong() >= 0);
+
+        // Items older than maximumAge compared to the newest item get
+        // discarded when a new item is added, so keep adding items until the
+        // initial ones are gone.
+        auto oldestAfterAdding = [&, value = 10]() mutable {
+            valueSource->setValue(value++);
+            return historySource->item(historySource->itemCount() - 1).toInt();
+        };
+        QTRY_VERIFY_WITH_TIMEOUT(oldestAfterAdding() >= 10, 5000);
+        QCOMPARE(timestamps->itemCount(), historySource->itemCount());
+        QVERIFY(timestamps->maximum().toLongLong() <= 200);
+
+        // Disabling maximum age uses maximumHistory again.
+        const auto count = historySource->itemCount();
+        historySource->setMaximumAge(0);
+        QCOMPARE(historySource->itemCount(), qMin(count, 2));
+    }
+
     void testWithModel()
     {
         auto model = std::make_unique<TestModel>();
@@ -51,6 +51,34 @@ private Q_SLOTS:
             << QVariantList{QColor{Qt::red}.rgba(), QColor{Qt::green}.rgba(), QColor{Qt::blue}.rgba(), QColor{Qt::red}.rgba(), QColor{Qt::green}.rgba(), QColor{Qt::blue}.rgba()}
             << QVariant{QColor{Qt::blue}.rgba()}
             << QVariant{QColor{Qt::red}.rgba()};
+
+        QTest::newRow("unused entries")
+            << QVariantList{qs("one"), qs("three"), qs("four")}
+            << QVariantMap{{qs("one"), 4}, {qs("two"), 10}, {qs("three"), 2}}
+            << QVariantList{4, 2, QVariant{}}
+            << QVariant{2}
+            << QVariant{4};
+
+        QTest::newRow("integer keys")
+            << QVariantList{1, 2, 1, 3}
+            << QVariantMap{{qs("1"), 10}, {qs("2"), 20}, {qs("03"), 30}}
+            << QVariantList{10, 20, 10, QVariant{}}
+            << QVariant{10}
+            << QVariant{20};
+
+        QTest::newRow("double values with integer keys")
+            << QVariantList{1.0, 2.0, 2.5, 3.0}
+            << QVariantMap{{qs("1"), 10}, {qs("2"), 20}, {qs("2.5"), 25}}
+            << QVariantList{10, 20, 25, QVariant{}}
+            << QVariant{10}
+            << QVariant{25};
+
+        QTest::newRow("string values with integer keys")
+            << QVariantList{qs("1"), qs("2"), qs("01"), qs("three")}
+            << QVariantMap{{qs("1"), 10}, {qs("2"), 20}, {qs("three"), 30}}
+            << QVariantList{10, 20, QVariant{}, 30}
+            << QVariant{10}
+            << QVariant{30};
         // clang-format on
     }
 
@@ -0,0 +1,173 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QRegularExpression>
+#include <QTemporaryFile>
+#include <QTest>
+#include <QtEndian>
+
+#include "datasource/MappedFileSource.h"
+
+class FileBuilder
+{
+public:
+    FileBuilder &header(quint32 columnCount, quint64 rowCount, const QByteArray &magic = QByteArrayLiteral("KQCB"), quint32 version = 1)
+    {
+        data.append(magic);
+        append<quint32>(version);
+        append<quint32>(columnCount);
+        append<quint32>(0);
+        append<quint64>(rowCount);
+        return *this;
+    }
+
+    FileBuilder &column(quint32 type, double minimum, double maximum)
+    {
+        append<quint32>(type);
+        append<quint32>(0);
+        append<double>(minimum);
+        append<double>(maximum);
+        return *this;
+    }
+
+    template<typename T>
+    FileBuilder &values(const QList<T> &values)
+    {
+        for (auto value : values) {
+            append<T>(value);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void append(T value)
+    {
+        char buffer[sizeof(T)];
+        qToLittleEndian<T>(value, buffer);
+        data.append(buffer, sizeof(T));
+    }
+
+    QByteArray data;
+};
+
+class MappedFileSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        auto source = std::make_unique<MappedFileSource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->columnCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+    }
+
+    void testValidFile()
+    {
+        FileBuilder builder;
+        builder.header(2, 3)
+            .column(2, -2.0, 4.0)
+            .column(1, 10.0, 30.0)
+            .values(QList<double>{1.5, -2.0, 4.0})
+            .values(QList<float>{10.0f, 20.0f, 30.0f});
+
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(builder.data);
+        file.flush();
+
+        auto source = std::make_unique<MappedFileSource>();
+        source->setFileName(file.fileName());
+
+        QCOMPARE(source->columnCount(), 2);
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(0).toDouble(), 1.5);
+        QCOMPARE(source->item(1).toDouble(), -2.0);
+        QCOMPARE(source->item(2).toDouble(), 4.0);
+        QCOMPARE(source->item(3), QVariant{});
+        QCOMPARE(source->minimum().toDouble(), -2.0);
+        QCOMPARE(source->maximum().toDouble(), 4.0);
+
+        qreal output[5];
+        source->readValues(-1, 5, output);
+        QCOMPARE(QList<qreal>(output, output + 5), (QList<qreal>{0.0, 1.5, -2.0, 4.0, 0.0}));
+
+        source->setColumn(1);
+        QCOMPARE(source->itemCount(), 3);
+        QCOMPARE(source->item(1).toDouble(), 20.0);
+        QCOMPARE(source->minimum().toDouble(), 10.0);
+        QCOMPARE(source->maximum().toDouble(), 30.0);
+
+        source->readValues(0, 3, output);
+        QCOMPARE(QList<qreal>(output, output + 3), (QList<qreal>{10.0, 20.0, 30.0}));
+
+        source->setColumn(2);
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+    }
+
+    void testInvalidFile_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+
+        QTest::newRow("empty") << QByteArray{};
+        QTest::newRow("truncated header") << FileBuilder{}.header(1, 3).data.left(10);
+        QTest::newRow("bad magic") << FileBuilder{}.header(1, 1, QByteArrayLiteral("ABCD")).column(2, 0.0, 1.0).values(QList<double>{1.0}).data;
+        QTest::newRow("bad version") << FileBuilder{}.header(1, 1, QByteArrayLiteral("KQCB"), 2).column(2, 0.0, 1.0).values(QList<double>{1.0}).data;
+        QTest::newRow("truncated columns") << FileBuilder{}.header(2, 1).column(2, 0.0, 1.0).data;
+        QTest::newRow("unknown type") << FileBuilder{}.header(1, 1).column(3, 0.0, 1.0).values(QList<double>{1.0}).data;
+        QTest::newRow("too few values") << FileBuilder{}.header(1, 3).column(2, 0.0, 1.0).values(QList<double>{1.0, 2.0}).data;
+        QTest::newRow("too few values in last column")
+            << FileBuilder{}.header(2, 2).column(2, 0.0, 1.0).column(1, 0.0, 1.0).values(QList<double>{1.0, 2.0}).values(QList<float>{1.0f}).data;
+    }
+
+    void testInvalidFile()
+    {
+        QFETCH(QByteArray, data);
+
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(data);
+        file.flush();
+
+        QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("MappedFileSource:")));
+
+        auto source = std::make_unique<MappedFileSource>();
+        source->setFileName(file.fileName());
+
+        QCOMPARE(source->columnCount(), 0);
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+
+        qreal output[2] = {1.0, 1.0};
+        source->readValues(0, 2, output);
+        QCOMPARE(output[0], 0.0);
+        QCOMPARE(output[1], 0.0);
+    }
+
+    void testMissingFile()
+    {
+        QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("MappedFileSource: Could not open")));
+
+        auto source = std::make_unique<MappedFileSource>();
+        source->setFileName(QStringLiteral("/this/file/does/not/exist"));
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+    }
+};
+
+QTEST_GUILESS_MAIN(MappedFileSourceTest)
+
+#include "MappedFileSourceTest.moc"
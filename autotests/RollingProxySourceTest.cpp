@@ -0,0 +1,157 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <cmath>
+
+#include <QStandardItemModel>
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/ModelSource.h"
+#include "datasource/RollingProxySource.h"
+
+class RollingProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        // Basic creation should create an empty source.
+        auto source = std::make_unique<RollingProxySource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+        QCOMPARE(source->source(), nullptr);
+    }
+
+    void testStatistics_data()
+    {
+        QTest::addColumn<RollingProxySource::Statistic>("statistic");
+        QTest::addColumn<qreal>("percentile");
+        QTest::addColumn<bool>("reversed");
+        QTest::addColumn<QVariantList>("expected");
+
+        // Using a window size of 3 over 4, 8, 2, 6, 0.
+        QTest::newRow("mean") << RollingProxySource::Mean << 50.0 << false << QVariantList{4.0, 6.0, 14.0 / 3.0, 16.0 / 3.0, 8.0 / 3.0};
+        QTest::newRow("mean reversed") << RollingProxySource::Mean << 50.0 << true << QVariantList{14.0 / 3.0, 16.0 / 3.0, 8.0 / 3.0, 3.0, 0.0};
+        QTest::newRow("exponential mean") << RollingProxySource::ExponentialMean << 50.0 << false << QVariantList{4.0, 6.0, 4.0, 5.0, 2.5};
+        QTest::newRow("median") << RollingProxySource::Percentile << 50.0 << false << QVariantList{4.0, 4.0, 4.0, 6.0, 2.0};
+        QTest::newRow("minimum") << RollingProxySource::Percentile << 0.0 << false << QVariantList{4.0, 4.0, 2.0, 2.0, 0.0};
+        QTest::newRow("maximum") << RollingProxySource::Percentile << 100.0 << false << QVariantList{4.0, 8.0, 8.0, 8.0, 6.0};
+    }
+
+    void testStatistics()
+    {
+        auto arraySource = std::make_unique<ArraySource>();
+        arraySource->setArray({4, 8, 2, 6, 0});
+
+        QFETCH(RollingProxySource::Statistic, statistic);
+        QFETCH(qreal, percentile);
+        QFETCH(bool, reversed);
+        QFETCH(QVariantList, expected);
+
+        auto source = std::make_unique<RollingProxySource>();
+        source->setSource(arraySource.get());
+        source->setWindowSize(3);
+        source->setStatistic(statistic);
+        source->setPercentile(percentile);
+        source->setReversed(reversed);
+
+        QCOMPARE(source->itemCount(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(source->item(i).toDouble(), expected.at(i).toDouble());
+        }
+    }
+
+    void testNotANumber_data()
+    {
+        QTest::addColumn<RollingProxySource::Statistic>("statistic");
+        QTest::addColumn<QVariantList>("expected");
+
+        // Using a window size of 3 over 4, NaN, 2, 6, 0. NaN is left out of
+        // the window.
+        QTest::newRow("mean") << RollingProxySource::Mean << QVariantList{4.0, 4.0, 3.0, 4.0, 8.0 / 3.0};
+        QTest::newRow("exponential mean") << RollingProxySource::ExponentialMean << QVariantList{4.0, 4.0, 3.0, 4.5, 2.25};
+        QTest::newRow("median") << RollingProxySource::Percentile << QVariantList{4.0, 4.0, 2.0, 2.0, 2.0};
+    }
+
+    void testNotANumber()
+    {
+        QFETCH(RollingProxySource::Statistic, statistic);
+        QFETCH(QVariantList, expected);
+
+        auto arraySource = std::make_unique<ArraySource>();
+        arraySource->setArray({4, qQNaN(), 2, 6, 0});
+
+        auto source = std::make_unique<RollingProxySource>();
+        source->setSource(arraySource.get());
+        source->setWindowSize(3);
+        source->setStatistic(statistic);
+
+        QCOMPARE(source->itemCount(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(source->item(i).toDouble(), expected.at(i).toDouble());
+        }
+        QVERIFY(std::isfinite(source->minimum().toDouble()));
+        QVERIFY(std::isfinite(source->maximum().toDouble()));
+
+        // A window without any valid values results in NaN.
+        arraySource->setArray({qQNaN(), 1});
+        QVERIFY(std::isnan(source->item(0).toDouble()));
+        QCOMPARE(source->item(1).toDouble(), 1.0);
+        QCOMPARE(source->minimum().toDouble(), 1.0);
+    }
+
+    void testAppend_data()
+    {
+        QTest::addColumn<RollingProxySource::Statistic>("statistic");
+
+        QTest::newRow("mean") << RollingProxySource::Mean;
+        QTest::newRow("exponential mean") << RollingProxySource::ExponentialMean;
+        QTest::newRow("percentile") << RollingProxySource::Percentile;
+    }
+
+    void testAppend()
+    {
+        QFETCH(RollingProxySource::Statistic, statistic);
+
+        QStandardItemModel model;
+
+        auto modelSource = std::make_unique<ModelSource>();
+        modelSource->setModel(&model);
+        modelSource->setRole(Qt::DisplayRole);
+
+        auto source = std::make_unique<RollingProxySource>();
+        source->setSource(modelSource.get());
+        source->setWindowSize(7);
+        source->setStatistic(statistic);
+
+        for (int i = 0; i < 50; ++i) {
+            model.appendRow(new QStandardItem{QString::number((i * 37) % 23)});
+
+            // Incrementally calculated statistics should match recalculated ones.
+            RollingProxySource reference;
+            reference.setSource(modelSource.get());
+            reference.setWindowSize(7);
+            reference.setStatistic(statistic);
+
+            QCOMPARE(source->itemCount(), reference.itemCount());
+            for (int item = 0; item < source->itemCount(); ++item) {
+                QCOMPARE(source->item(item).toDouble(), reference.item(item).toDouble());
+            }
+            QCOMPARE(source->minimum(), reference.minimum());
+            QCOMPARE(source->maximum(), reference.maximum());
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(RollingProxySourceTest)
+
+#include "RollingProxySourceTest.moc"
@@ -0,0 +1,123 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QRegularExpression>
+#include <QSignalSpy>
+#include <QTest>
+#include <QThread>
+
+#include "datasource/StreamSource.h"
+
+class StreamSourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        auto source = std::make_unique<StreamSource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+        QCOMPARE(source->capacity(), 65536);
+    }
+
+    void testThreadedProducer()
+    {
+        constexpr int count = 100'000;
+
+        auto source = std::make_unique<StreamSource>();
+        source->setCapacity(4096);
+        source->setInterval(1);
+
+        QSignalSpy dataChangedSpy{source.get(), &ChartDataSource::dataChanged};
+
+        auto producer = source->producer();
+        QVERIFY(producer.isValid());
+
+        std::unique_ptr<QThread> thread{QThread::create([&producer]() {
+            for (int i = 0; i < count; ++i) {
+                // Wait for the GUI thread to drain the buffer when it is full.
+                while (!producer.push(qreal(i))) {
+                    QThread::yieldCurrentThread();
+                }
+            }
+        })};
+        thread->start();
+
+        QTRY_COMPARE_WITH_TIMEOUT(source->itemCount(), count, 30'000);
+        QVERIFY(thread->wait());
+
+        for (int i = 0; i < count; ++i) {
+            QCOMPARE(source->item(i).toDouble(), qreal(i));
+        }
+
+        QCOMPARE(source->minimum().toDouble(), 0.0);
+        QCOMPARE(source->maximum().toDouble(), qreal(count - 1));
+
+        // Values are added in batches, with one change notification per batch.
+        QVERIFY(dataChangedSpy.size() > 0);
+        QVERIFY(dataChangedSpy.size() < count / 10);
+    }
+
+    void testOverflow()
+    {
+        auto source = std::make_unique<StreamSource>();
+        source->setCapacity(8);
+        QCOMPARE(source->capacity(), 8);
+
+        auto producer = source->producer();
+
+        // Without an event loop nothing is drained, so only capacity values fit.
+        int added = 0;
+        for (int i = 0; i < 20; ++i) {
+            added += producer.push(qreal(i)) ? 1 : 0;
+        }
+        QCOMPARE(added, 8);
+        QCOMPARE(source->droppedCount(), 12);
+
+        const qreal values[] = {20.0, 21.0};
+        QCOMPARE(producer.push(values, 2), 0);
+        QCOMPARE(source->droppedCount(), 14);
+
+        QTRY_COMPARE(source->itemCount(), 8);
+        for (int i = 0; i < 8; ++i) {
+            QCOMPARE(source->item(i).toDouble(), qreal(i));
+        }
+
+        // Once drained, values can be added again.
+        QCOMPARE(producer.push(values, 2), 2);
+        QTRY_COMPARE(source->itemCount(), 10);
+        QCOMPARE(source->item(9).toDouble(), 21.0);
+    }
+
+    void testSingleProducer()
+    {
+        auto source = std::make_unique<StreamSource>();
+
+        auto producer = std::make_unique<StreamSource::Producer>(source->producer());
+        QVERIFY(producer->isValid());
+
+        QTest::ignoreMessage(QtWarningMsg, QRegularExpression(QStringLiteral("single producer")));
+        auto second = source->producer();
+        QVERIFY(!second.isValid());
+        QVERIFY(!second.push(1.0));
+
+        // Once the producer is gone, a new one can be created.
+        producer.reset();
+        auto third = source->producer();
+        QVERIFY(third.isValid());
+        QVERIFY(third.push(1.0));
+        QTRY_COMPARE(source->itemCount(), 1);
+    }
+};
+
+QTEST_GUILESS_MAIN(StreamSourceTest)
+
+#include "StreamSourceTest.moc"
@@ -0,0 +1,79 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include <QTest>
+
+#include "datasource/ArraySource.h"
+#include "datasource/TransformProxySource.h"
+
+class TransformProxySourceTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCreate()
+    {
+        // Basic creation should create an empty source.
+        auto source = std::make_unique<TransformProxySource>();
+
+        QCOMPARE(source->itemCount(), 0);
+        QCOMPARE(source->item(0), QVariant{});
+        QCOMPARE(source->minimum(), QVariant{});
+        QCOMPARE(source->maximum(), QVariant{});
+        QCOMPARE(source->sources(), QList<ChartDataSource *>{});
+    }
+
+    void testOperation_data()
+    {
+        QTest::addColumn<TransformProxySource::Operation>("operation");
+        QTest::addColumn<QVariantList>("expected");
+
+        // Combining 2, 4, 0, 6 with 1, 4, 3.
+        QTest::newRow("sum") << TransformProxySource::Sum << QVariantList{3.0, 8.0, 3.0};
+        QTest::newRow("difference") << TransformProxySource::Difference << QVariantList{1.0, 0.0, -3.0};
+        QTest::newRow("product") << TransformProxySource::Product << QVariantList{2.0, 16.0, 0.0};
+        QTest::newRow("quotient") << TransformProxySource::Quotient << QVariantList{2.0, 1.0, 0.0};
+        QTest::newRow("fraction") << TransformProxySource::Fraction << QVariantList{2.0 / 3.0, 0.5, 0.0};
+        QTest::newRow("minimum") << TransformProxySource::Minimum << QVariantList{1.0, 4.0, 0.0};
+        QTest::newRow("maximum") << TransformProxySource::Maximum << QVariantList{2.0, 4.0, 3.0};
+        QTest::newRow("average") << TransformProxySource::Average << QVariantList{1.5, 4.0, 1.5};
+    }
+
+    void testOperation()
+    {
+        auto first = std::make_unique<ArraySource>();
+        first->setArray({2, 4, 0, 6});
+        auto second = std::make_unique<ArraySource>();
+        second->setArray({1, 4, 3});
+
+        QFETCH(TransformProxySource::Operation, operation);
+        QFETCH(QVariantList, expected);
+
+        auto source = std::make_unique<TransformProxySource>();
+        source->setSources({first.get(), second.get()});
+        source->setOperation(operation);
+
+        QCOMPARE(source->itemCount(), expected.size());
+        for (int i = 0; i < expected.size(); ++i) {
+            QCOMPARE(source->item(i).toDouble(), expected.at(i).toDouble());
+        }
+        QCOMPARE(source->item(expected.size()), QVariant{});
+
+        // Changing a source should recalculate the values.
+        second->setArray({1, 4, 3, 2});
+        QCOMPARE(source->itemCount(), 4);
+
+        // Removing a source should use only the remaining source.
+        second.reset();
+        QCOMPARE(source->sources().size(), 1);
+        QCOMPARE(source->itemCount(), 4);
+    }
+};
+
+QTEST_GUILESS_MAIN(TransformProxySourceTest)
+
+#include "TransformProxySourceTest.moc"
@@ -47,6 +47,19 @@ TestCase {
         verify(item)
         verify(waitForRendering(item))
     }
-}
 
+    function test_itemAt() {
+        var item = createTemporaryObject(simple, testCase)
+        verify(item)
+        verify(waitForRendering(item))
+
+        // The last bar covers the right fifth of the chart.
+        var result = item.itemAt(180, 100)
+        compare(result.sourceIndex, 0)
+        compare(result.itemIndex, 4)
+        compare(result.value, 5)
 
+        compare(item.itemAt(180, -10).itemIndex, undefined)
+        compare(item.nearestItem(180, -10).itemIndex, 4)
+    }
+}
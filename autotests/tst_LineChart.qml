@@ -47,4 +47,19 @@ TestCase {
         verify(item)
         verify(waitForRendering(item))
     }
+
+    function test_itemAt() {
+        var item = createTemporaryObject(simple, testCase)
+        verify(item)
+        verify(waitForRendering(item))
+
+        // The last point is at the top right of the chart.
+        var result = item.itemAt(198, 3)
+        compare(result.sourceIndex, 0)
+        compare(result.itemIndex, 4)
+        compare(result.value, 5)
+
+        compare(item.itemAt(125, 0).itemIndex, undefined)
+        compare(item.nearestItem(195, 20).itemIndex, 4)
+    }
 }
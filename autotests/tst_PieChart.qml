@@ -88,5 +88,20 @@ TestCase {
         verify(item)
         verify(waitForRendering(item))
     }
-}
 
+    function test_itemAt() {
+        var item = createTemporaryObject(simple, testCase)
+        verify(item)
+        verify(waitForRendering(item))
+
+        // The first item starts at the top and the fourth item covers the bottom.
+        var result = item.itemAt(116, 7)
+        compare(result.sourceIndex, 0)
+        compare(result.itemIndex, 0)
+        compare(result.value, 1)
+
+        compare(item.itemAt(100, 195).itemIndex, 3)
+        compare(item.itemAt(100, 100).itemIndex, undefined)
+        compare(item.nearestItem(100, 100).itemIndex, 0)
+    }
+}
@@ -7,11 +7,14 @@
 
 #include "AxisLabels.h"
 
+#include <cmath>
+
 #include <QDebug>
 #include <QQmlContext>
 
+#include "AxisTicks.h"
 #include "ItemBuilder.h"
-#include "datasource/ChartDataSource.h"
+#include "datasource/ChartAxisSource.h"
 
 AxisLabelsAttached::AxisLabelsAttached(QObject *parent)
     : QObject(parent)
@@ -52,7 +55,9 @@ AxisLabels::AxisLabels(QQuickItem *parent)
     : QQuickItem(parent)
 {
     m_itemBuilder = std::make_unique<ItemBuilder>();
-    connect(m_itemBuilder.get(), &ItemBuilder::finished, this, &AxisLabels::polish);
+    // The builder is still in use while emitting finished, so delay taking
+    // the created items.
+    connect(m_itemBuilder.get(), &ItemBuilder::finished, this, &AxisLabels::onLabelsCreated, Qt::QueuedConnection);
     connect(m_itemBuilder.get(), &ItemBuilder::beginCreate, this, &AxisLabels::onBeginCreate);
 }
 
@@ -70,7 +75,8 @@ void AxisLabels::setDirection(AxisLabels::Direction newDirection)
     }
 
     m_direction = newDirection;
-    polish();
+    m_labelExtent = 0.0;
+    updateLabels();
     Q_EMIT directionChanged();
 }
 
@@ -85,6 +91,13 @@ void AxisLabels::setDelegate(QQmlComponent *newDelegate)
         return;
     }
 
+    m_labels.clear();
+    m_itemBuilder->clear();
+    m_itemBuilder->setCount(0);
+    m_creatingLabels = false;
+    m_creationFailed = false;
+    m_labelExtent = 0.0;
+
     m_itemBuilder->setComponent(newDelegate);
     updateLabels();
     Q_EMIT delegateChanged();
@@ -106,6 +119,7 @@ void AxisLabels::setSource(ChartDataSource *newSource)
     }
 
     m_source = newSource;
+    m_labelExtent = 0.0;
 
     if (m_source) {
         connect(m_source, &ChartDataSource::dataChanged, this, [this]() {
@@ -149,55 +163,94 @@ void AxisLabels::setConstrainToBounds(bool newConstrainToBounds)
     Q_EMIT constrainToBoundsChanged();
 }
 
-void AxisLabels::updatePolish()
+AxisLabels::LabelMode AxisLabels::labelMode() const
+{
+    return m_labelMode;
+}
+
+void AxisLabels::setLabelMode(AxisLabels::LabelMode newLabelMode)
 {
-    if (!m_itemBuilder->isFinished()) {
+    if (newLabelMode == m_labelMode) {
         return;
     }
 
+    m_labelMode = newLabelMode;
+    updateLabels();
+    Q_EMIT labelModeChanged();
+}
+
+void AxisLabels::updatePolish()
+{
     auto maxWidth = 0.0;
     auto totalWidth = 0.0;
     auto maxHeight = 0.0;
     auto totalHeight = 0.0;
 
-    auto labels = m_itemBuilder->items();
-    for (auto label : labels) {
+    const auto &labels = m_labels;
+    for (const auto &label : labels) {
         maxWidth = std::max(maxWidth, label->implicitWidth());
         maxHeight = std::max(maxHeight, label->implicitHeight());
         totalWidth += label->implicitWidth();
         totalHeight += label->implicitHeight();
     }
 
+    // Labels that become larger may no longer fit, so determine which labels
+    // to display again. Only ever grow, so that labels do not keep switching
+    // between sets of labels with different sizes.
+    const auto labelExtent = isHorizontal() ? maxWidth : maxHeight;
+    if (m_labelMode == LabelMode::NonOverlappingLabels && labelExtent > m_labelExtent) {
+        const auto measured = m_labelExtent > 0.0;
+        m_labelExtent = labelExtent;
+        if (!measured || labelStep(m_sourceItemCount) != m_labelStep) {
+            updateLabels();
+            return;
+        }
+    }
+
     auto impWidth = isHorizontal() ? totalWidth : maxWidth;
     auto impHeight = isHorizontal() ? maxHeight : totalHeight;
 
-    if (qFuzzyCompare(impWidth, width()) && qFuzzyCompare(impHeight, height())) {
-        return;
-    }
-
     setImplicitSize(impWidth, impHeight);
 
-    auto spacing = (isHorizontal() ? width() : height()) / (labels.size() - 1);
+    // Labels are positioned according to the item of the source they display.
+    const auto length = isHorizontal() ? width() : height();
+    auto spacing = m_sourceItemCount > 1 ? length / (m_sourceItemCount - 1) * m_labelStep : 0.0;
+
+    // Ticks of an axis source that are not evenly spaced are positioned
+    // according to their value instead.
+    auto axisSource = qobject_cast<ChartAxisSource *>(m_source);
+    if (axisSource && axisSource->tickMode() == ChartAxisSource::TickMode::EvenTicks) {
+        axisSource = nullptr;
+    }
+    const auto minimum = axisSource ? axisSource->minimum().toDouble() : 0.0;
+    const auto distance = axisSource ? axisSource->maximum().toDouble() - minimum : 0.0;
+
     auto i = 0;
     auto layoutWidth = isHorizontal() ? 0.0 : width();
     auto layoutHeight = isHorizontal() ? height() : 0.0;
 
-    for (auto label : labels) {
+    for (const auto &label : labels) {
         auto x = 0.0;
         auto y = 0.0;
 
+        auto offset = i * spacing;
+        if (axisSource) {
+            const auto value = axisSource->item(i * m_labelStep).toDouble();
+            offset = distance > 0.0 ? (value - minimum) / distance * length : 0.0;
+        }
+
         switch (m_direction) {
         case Direction::HorizontalLeftRight:
-            x = i * spacing;
+            x = offset;
             break;
         case Direction::HorizontalRightLeft:
-            x = width() - i * spacing;
+            x = width() - offset;
             break;
         case Direction::VerticalTopBottom:
-            y = i * spacing;
+            y = offset;
             break;
         case Direction::VerticalBottomTop:
-            y = height() - i * spacing;
+            y = height() - offset;
             break;
         }
 
@@ -232,7 +285,11 @@ void AxisLabels::geometryChange(const QRectF &newGeometry, const QRectF &oldGeom
     QQuickItem::geometryChange(newGeometry, oldGeometry);
 
     if (newGeometry != oldGeometry) {
-        polish();
+        if (m_labelMode == LabelMode::NonOverlappingLabels && labelStep(m_sourceItemCount) != m_labelStep) {
+            updateLabels();
+        } else {
+            polish();
+        }
     }
 }
 
@@ -243,14 +300,85 @@ bool AxisLabels::isHorizontal()
 
 void AxisLabels::updateLabels()
 {
-    m_itemBuilder->clear();
+    m_sourceItemCount = m_itemBuilder->component() && m_source ? m_source->itemCount() : 0;
+    m_labelStep = labelStep(m_sourceItemCount);
+
+    auto count = m_sourceItemCount > 0 ? (m_sourceItemCount - 1) / m_labelStep + 1 : 0;
+    // The size of labels is not known before creating one, so only create the
+    // first label until we know which labels fit.
+    if (m_labelMode == LabelMode::NonOverlappingLabels && m_labelExtent <= 0.0) {
+        count = std::min(count, 1);
+    }
 
-    if (!m_itemBuilder->component() || !m_source) {
-        return;
+    if (m_labels.size() > count) {
+        m_labels.resize(count);
+    }
+
+    for (int i = 0; i < m_labels.size(); ++i) {
+        updateLabel(m_labels.at(i).get(), i * m_labelStep);
+    }
+
+    // Only create one batch of labels at a time. Once the batch is finished,
+    // this is called again to create any labels that are still missing.
+    if (count > m_labels.size() && !m_creatingLabels && !m_creationFailed) {
+        m_creatingLabels = true;
+        m_itemBuilder->setCount(count - m_labels.size());
+        m_itemBuilder->build(this);
     }
 
-    m_itemBuilder->setCount(m_source->itemCount());
-    m_itemBuilder->build(this);
+    polish();
+}
+
+int AxisLabels::labelStep(int itemCount)
+{
+    const auto length = isHorizontal() ? width() : height();
+    if (m_labelMode == LabelMode::AllLabels || itemCount <= 1 || length <= 0.0 || m_labelExtent <= 0.0) {
+        return 1;
+    }
+
+    // Use the smallest step from 1, 2, 5, 10, 20, 50, ... that places labels
+    // far enough apart that they do not overlap.
+    const auto minimumStep = m_labelExtent / (length / (itemCount - 1));
+    const auto step = std::min(std::ceil(AxisTicks::niceStep(minimumStep)), qreal(itemCount));
+    return std::max(1, int(step));
+}
+
+void AxisLabels::updateLabel(QQuickItem *item, int index)
+{
+    auto attached = static_cast<AxisLabelsAttached *>(qmlAttachedPropertiesObject<AxisLabels>(item, true));
+    attached->setIndex(index);
+    attached->setLabel(m_source ? labelText(m_source->item(index)) : QString{});
+}
+
+QString AxisLabels::labelText(const QVariant &value)
+{
+    switch (value.typeId()) {
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Float:
+    case QMetaType::Double:
+        break;
+    default:
+        return value.toString();
+    }
+
+    const auto number = value.toDouble();
+    auto itr = m_labelTexts.constFind(number);
+    if (itr != m_labelTexts.constEnd()) {
+        return itr.value();
+    }
+
+    // A moving range can produce an endless amount of values, so do not keep
+    // too many of them.
+    if (m_labelTexts.size() >= 1000) {
+        m_labelTexts.clear();
+    }
+
+    const auto text = value.toString();
+    m_labelTexts.insert(number, text);
+    return text;
 }
 
 void AxisLabels::onBeginCreate(int index, QQuickItem *item)
@@ -258,9 +386,36 @@ void AxisLabels::onBeginCreate(int index, QQuickItem *item)
     QObject::connect(item, &QQuickItem::implicitWidthChanged, this, &AxisLabels::polish);
     QObject::connect(item, &QQuickItem::implicitHeightChanged, this, &AxisLabels::polish);
 
-    auto attached = static_cast<AxisLabelsAttached *>(qmlAttachedPropertiesObject<AxisLabels>(item, true));
-    attached->setIndex(index);
-    attached->setLabel(m_source->item(index).toString());
+    updateLabel(item, (m_labels.size() + index) * m_labelStep);
+}
+
+void AxisLabels::onLabelsCreated()
+{
+    // Ignore batches that were cleared before they finished.
+    if (!m_creatingLabels || !m_itemBuilder->isFinished()) {
+        return;
+    }
+
+    const auto items = m_itemBuilder->items();
+    m_itemBuilder->clear();
+    m_itemBuilder->setCount(0);
+    m_creatingLabels = false;
+
+    for (const auto &item : items) {
+        // Keep the labels that were created, even if some of the batch failed.
+        if (!item) {
+            m_creationFailed = true;
+            continue;
+        }
+        m_labels.append(item);
+    }
+
+    if (m_creationFailed) {
+        qWarning() << "Label creation failed, make sure delegate is a QQuickItem";
+    }
+
+    // The number of labels may have changed while the labels were created.
+    updateLabels();
 }
 
 #include "moc_AxisLabels.cpp"
@@ -70,6 +70,17 @@ public:
     enum class Direction { HorizontalLeftRight, HorizontalRightLeft, VerticalTopBottom, VerticalBottomTop };
     Q_ENUM(Direction)
 
+    /*!
+     * \value AllLabels
+     *        Display a label for each item of the source.
+     * \value NonOverlappingLabels
+     *        Only display as many labels as fit without overlapping. Labels
+     *        are displayed for every first, second, fifth, tenth, and so on,
+     *        item of the source.
+     */
+    enum class LabelMode { AllLabels, NonOverlappingLabels };
+    Q_ENUM(LabelMode)
+
     explicit AxisLabels(QQuickItem *parent = nullptr);
     ~AxisLabels() override;
 
@@ -114,6 +125,23 @@ public:
     Q_SLOT void setConstrainToBounds(bool newConstrainToBounds);
     Q_SIGNAL void constrainToBoundsChanged();
 
+    /*!
+     * \qmlproperty enumeration AxisLabels::labelMode
+     * \qmlenumeratorsfrom AxisLabels::LabelMode
+     * \brief Which items of the source get a label.
+     *
+     * When this is AxisLabels.NonOverlappingLabels, the size of the labels is
+     * used to determine which labels can be displayed. Label items are only
+     * created for the labels that are displayed, so a source can contain many
+     * more items than there is space for labels.
+     *
+     * The default is AxisLabels.AllLabels.
+     */
+    Q_PROPERTY(AxisLabels::LabelMode labelMode READ labelMode WRITE setLabelMode NOTIFY labelModeChanged)
+    AxisLabels::LabelMode labelMode() const;
+    Q_SLOT void setLabelMode(AxisLabels::LabelMode newLabelMode);
+    Q_SIGNAL void labelModeChanged();
+
     static AxisLabelsAttached *qmlAttachedProperties(QObject *object)
     {
         return new AxisLabelsAttached(object);
@@ -126,15 +154,36 @@ protected:
 private:
     bool isHorizontal();
     void updateLabels();
+    int labelStep(int itemCount);
+    void updateLabel(QQuickItem *item, int index);
+    QString labelText(const QVariant &value);
     void onBeginCreate(int index, QQuickItem *item);
+    void onLabelsCreated();
 
     Direction m_direction = Direction::HorizontalLeftRight;
     ChartDataSource *m_source = nullptr;
     Qt::Alignment m_alignment = Qt::AlignHCenter | Qt::AlignVCenter;
     bool m_constrainToBounds = true;
+    LabelMode m_labelMode = LabelMode::AllLabels;
 
     std::unique_ptr<ItemBuilder> m_itemBuilder;
     bool m_layoutScheduled = false;
+    // Label items are kept when the source changes and only created or
+    // destroyed when the number of labels changes.
+    QList<std::shared_ptr<QQuickItem>> m_labels;
+    bool m_creatingLabels = false;
+    // Creating labels with the current delegate failed, so do not try again
+    // until the delegate changes.
+    bool m_creationFailed = false;
+    // Labels are displayed for every m_labelStep item of the source.
+    int m_labelStep = 1;
+    int m_sourceItemCount = 0;
+    // The largest size of a label along the axis, used to determine which
+    // labels fit.
+    qreal m_labelExtent = 0.0;
+    // Formatted text of numeric values, since these often repeat when the
+    // source changes.
+    QHash<qreal, QString> m_labelTexts;
 };
 
 #endif // AXISLABELS_H
@@ -7,8 +7,10 @@
 
 #include "GridLines.h"
 
-#include "LineGridNode.h"
+#include <cmath>
+
 #include "XYChart.h"
+#include "datasource/ChartAxisSource.h"
 
 LinePropertiesGroup::LinePropertiesGroup(GridLines *parent)
     : QObject(parent)
@@ -143,6 +145,34 @@ void GridLines::setChart(XYChart *newChart)
     Q_EMIT chartChanged();
 }
 
+ChartAxisSource *GridLines::source() const
+{
+    return m_source;
+}
+
+void GridLines::setSource(ChartAxisSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+
+    if (m_source) {
+        connect(m_source, &ChartAxisSource::dataChanged, this, &GridLines::update);
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            setSource(nullptr);
+        });
+    }
+
+    update();
+    Q_EMIT sourceChanged();
+}
+
 float GridLines::spacing() const
 {
     return m_spacing;
@@ -171,10 +201,9 @@ LinePropertiesGroup *GridLines::minorGroup() const
 
 QSGNode *GridLines::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
 {
-    if (!node) {
-        node = new QSGNode{};
-        node->appendChildNode(new LineGridNode{});
-        node->appendChildNode(new LineGridNode{});
+    auto gridNode = static_cast<LineGridNode *>(node);
+    if (!gridNode) {
+        gridNode = new LineGridNode{};
     }
 
     if (m_chart) {
@@ -185,25 +214,57 @@ QSGNode *GridLines::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
         }
     }
 
-    updateLines(static_cast<LineGridNode *>(node->childAtIndex(0)), m_minor.get());
-    updateLines(static_cast<LineGridNode *>(node->childAtIndex(1)), m_major.get());
+    const auto ticks = m_source ? m_source->ticks() : AxisTicks{};
 
-    return node;
+    gridNode->setRect(boundingRect());
+    gridNode->setVertical(m_direction == Direction::Vertical);
+    // Minor lines go first, so major lines are drawn on top of them.
+    gridNode->setLines({lines(m_minor.get(), ticks.minor), lines(m_major.get(), ticks.major)});
+    gridNode->update();
+
+    return gridNode;
 }
 
-void GridLines::updateLines(LineGridNode *node, LinePropertiesGroup *properties)
+LineGridNode::Lines GridLines::lines(LinePropertiesGroup *properties, const QList<qreal> &ticks)
 {
-    node->setVisible(properties->visible());
-    node->setRect(boundingRect());
-    node->setVertical(m_direction == Direction::Vertical);
-    node->setColor(properties->color());
-    node->setLineWidth(properties->lineWidth());
-    if (properties->count() > 0) {
-        node->setSpacing(m_direction == Direction::Horizontal ? width() / (properties->count() + 1) : height() / (properties->count() + 1));
-    } else {
-        node->setSpacing(m_spacing * properties->frequency());
+    LineGridNode::Lines result;
+    result.color = properties->color();
+    result.lineWidth = properties->lineWidth();
+
+    if (!properties->visible()) {
+        return result;
+    }
+
+    const auto length = m_direction == Direction::Horizontal ? width() : height();
+
+    if (m_source) {
+        const auto minimum = m_source->minimum().toDouble();
+        const auto distance = m_source->maximum().toDouble() - minimum;
+
+        result.positions.reserve(ticks.size());
+        for (auto tick : ticks) {
+            const auto position = distance > 0.0 ? (tick - minimum) / distance * length : 0.0;
+            // Values increase upwards, while positions increase downwards.
+            result.positions.append(m_direction == Direction::Horizontal ? position : length - position);
+        }
+        return result;
     }
-    node->update();
+
+    const auto spacing = properties->count() > 0 ? length / (properties->count() + 1) : m_spacing * properties->frequency();
+
+    // Lines are always placed at both edges, with lines at every spacing in
+    // between.
+    result.positions.append(0.0);
+    if (spacing > 0.0 && std::isfinite(spacing)) {
+        const auto count = int(std::floor(length / std::ceil(spacing)));
+        result.positions.reserve(count + 2);
+        for (int i = 1; i <= count; ++i) {
+            result.positions.append(i * spacing);
+        }
+    }
+    result.positions.append(length);
+
+    return result;
 }
 
 #include "moc_GridLines.cpp"
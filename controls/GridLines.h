@@ -12,8 +12,10 @@
 
 #include <QQuickItem>
 
+#include "LineGridNode.h"
+
+class ChartAxisSource;
 class GridLines;
-class LineGridNode;
 class XYChart;
 
 class LinePropertiesGroup : public QObject
@@ -93,6 +95,20 @@ public:
     void setChart(XYChart *newChart);
     Q_SIGNAL void chartChanged();
 
+    /*!
+     * \qmlproperty ChartAxisSource GridLines::source
+     * \brief An axis source to place the lines at the ticks of.
+     *
+     * When this is set, major lines are placed at the major ticks of the
+     * source and minor lines at its minor ticks, so the lines match labels
+     * that use the same source. The spacing, frequency and count of lines are
+     * then ignored.
+     */
+    Q_PROPERTY(ChartAxisSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartAxisSource *source() const;
+    void setSource(ChartAxisSource *newSource);
+    Q_SIGNAL void sourceChanged();
+
     /*!
      * \qmlproperty real GridLines::spacing
      */
@@ -123,10 +139,11 @@ public:
 
 private:
     QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *) override;
-    void updateLines(LineGridNode *node, LinePropertiesGroup *properties);
+    LineGridNode::Lines lines(LinePropertiesGroup *properties, const QList<qreal> &ticks);
 
     GridLines::Direction m_direction = Direction::Horizontal;
     XYChart *m_chart = nullptr;
+    ChartAxisSource *m_source = nullptr;
     float m_spacing = 10.0;
 
     std::unique_ptr<LinePropertiesGroup> m_major;
@@ -6,7 +6,9 @@
 
 #include "LegendLayout.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "Chart.h"
 #include "ItemBuilder.h"
@@ -145,18 +147,16 @@ void LegendLayout::updatePolish()
 
     qreal layoutWidth = width();
 
-    std::tie(columns, rows, itemWidth, itemHeight) = determineColumns();
+    m_layout = determineColumns();
+    std::tie(columns, rows, itemWidth, itemHeight) = m_layout;
 
     auto column = 0;
     auto row = 0;
 
-    const auto items = childItems();
-    for (auto item : items) {
-        if (!item->isVisible() || item->implicitWidth() <= 0 || item->implicitHeight() <= 0) {
-            continue;
-        }
-
-        auto attached = static_cast<LegendLayoutAttached *>(qmlAttachedPropertiesObject<LegendLayout>(item, true));
+    const auto &itemConstraints = constraints();
+    for (int i = 0; i < itemConstraints.items.size(); ++i) {
+        auto item = itemConstraints.items.at(i);
+        auto attached = itemConstraints.attached.at(i);
 
         auto x = (itemWidth + m_horizontalSpacing) * column;
         auto y = (itemHeight + m_verticalSpacing) * row;
@@ -183,10 +183,13 @@ void LegendLayout::updatePolish()
 
 void LegendLayout::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
-    if (newGeometry != oldGeometry) {
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+
+    // The layout only depends on our width. While resizing, the width often
+    // changes without changing the layout, so only reflow if it does.
+    if (m_completed && newGeometry.width() != oldGeometry.width() && determineColumns() != m_layout) {
         polish();
     }
-    QQuickItem::geometryChange(newGeometry, oldGeometry);
 }
 
 void LegendLayout::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data)
@@ -198,16 +201,16 @@ void LegendLayout::itemChange(QQuickItem::ItemChange change, const QQuickItem::I
     if (change == QQuickItem::ItemChildAddedChange) {
         auto item = data.item;
 
-        connect(item, &QQuickItem::implicitWidthChanged, this, &LegendLayout::polish);
-        connect(item, &QQuickItem::implicitHeightChanged, this, &LegendLayout::polish);
-        connect(item, &QQuickItem::visibleChanged, this, &LegendLayout::polish);
+        connect(item, &QQuickItem::implicitWidthChanged, this, &LegendLayout::invalidateConstraints);
+        connect(item, &QQuickItem::implicitHeightChanged, this, &LegendLayout::invalidateConstraints);
+        connect(item, &QQuickItem::visibleChanged, this, &LegendLayout::invalidateConstraints);
 
         auto attached = static_cast<LegendLayoutAttached *>(qmlAttachedPropertiesObject<LegendLayout>(item, true));
-        connect(attached, &LegendLayoutAttached::minimumWidthChanged, this, &LegendLayout::polish);
-        connect(attached, &LegendLayoutAttached::preferredWidthChanged, this, &LegendLayout::polish);
-        connect(attached, &LegendLayoutAttached::maximumWidthChanged, this, &LegendLayout::polish);
+        connect(attached, &LegendLayoutAttached::minimumWidthChanged, this, &LegendLayout::invalidateConstraints);
+        connect(attached, &LegendLayoutAttached::preferredWidthChanged, this, &LegendLayout::invalidateConstraints);
+        connect(attached, &LegendLayoutAttached::maximumWidthChanged, this, &LegendLayout::invalidateConstraints);
 
-        polish();
+        invalidateConstraints();
     }
 
     if (change == QQuickItem::ItemChildRemovedChange) {
@@ -219,33 +222,39 @@ void LegendLayout::itemChange(QQuickItem::ItemChange change, const QQuickItem::I
             attached->disconnect(this);
         }
 
-        polish();
+        invalidateConstraints();
     }
 
     QQuickItem::itemChange(change, data);
 }
 
-// Determine how many columns and rows should be used for placing items and how
-// large each item should be.
-std::tuple<int, int, qreal, qreal> LegendLayout::determineColumns()
+void LegendLayout::invalidateConstraints()
 {
-    auto minWidth = -std::numeric_limits<qreal>::max();
-    auto preferredWidth = -std::numeric_limits<qreal>::max();
-    auto maxWidth = std::numeric_limits<qreal>::max();
-    auto maxHeight = -std::numeric_limits<qreal>::max();
+    m_constraints.reset();
+    polish();
+}
 
-    const auto items = childItems();
+// Determine which items should be placed and the minimum, preferred and
+// maximum width of all items. These are determined from the attached object,
+// or implicitWidth for minimum size if minimumWidth has not been set.
+//
+// We also determine the maximum height of items so we do not need to do that
+// later.
+const LegendLayout::Constraints &LegendLayout::constraints()
+{
+    if (m_constraints) {
+        return *m_constraints;
+    }
+
+    Constraints result;
+    result.minimumWidth = -std::numeric_limits<qreal>::max();
+    result.preferredWidth = -std::numeric_limits<qreal>::max();
+    result.maximumWidth = std::numeric_limits<qreal>::max();
+    result.maximumHeight = -std::numeric_limits<qreal>::max();
 
     // Keep track of actual visual and visible items, since childItems() also
     // includes stuff like repeaters.
-    auto itemCount = 0;
-
-    // First, we determine the minimum, preferred and maximum width of all
-    // items. These are determined from the attached object, or implicitWidth
-    // for minimum size if minimumWidth has not been set.
-    //
-    // We also determine the maximum height of items so we do not need to do
-    // that later.
+    const auto items = childItems();
     for (auto item : items) {
         if (!item->isVisible() || item->implicitWidth() <= 0 || item->implicitHeight() <= 0) {
             continue;
@@ -254,28 +263,44 @@ std::tuple<int, int, qreal, qreal> LegendLayout::determineColumns()
         auto attached = static_cast<LegendLayoutAttached *>(qmlAttachedPropertiesObject<LegendLayout>(item, true));
 
         if (attached->isMinimumWidthValid()) {
-            minWidth = std::max(minWidth, attached->minimumWidth());
+            result.minimumWidth = std::max(result.minimumWidth, attached->minimumWidth());
         } else {
-            minWidth = std::max(minWidth, item->implicitWidth());
+            result.minimumWidth = std::max(result.minimumWidth, item->implicitWidth());
         }
 
         if (attached->isPreferredWidthValid()) {
-            preferredWidth = std::max(preferredWidth, attached->preferredWidth());
+            result.preferredWidth = std::max(result.preferredWidth, attached->preferredWidth());
         }
 
         if (attached->isMaximumWidthValid()) {
-            maxWidth = std::min(maxWidth, attached->maximumWidth());
+            result.maximumWidth = std::min(result.maximumWidth, attached->maximumWidth());
         }
 
-        maxHeight = std::max(maxHeight, item->implicitHeight());
+        result.maximumHeight = std::max(result.maximumHeight, item->implicitHeight());
 
-        itemCount++;
+        result.items.append(item);
+        result.attached.append(attached);
     }
 
+    m_constraints = result;
+    return *m_constraints;
+}
+
+// Determine how many columns and rows should be used for placing items and how
+// large each item should be.
+std::tuple<int, int, qreal, qreal> LegendLayout::determineColumns()
+{
+    const auto &itemConstraints = constraints();
+
+    const auto itemCount = int(itemConstraints.items.size());
     if (itemCount == 0) {
         return std::make_tuple(0, 0, 0, 0);
     }
 
+    const auto minWidth = itemConstraints.minimumWidth;
+    const auto preferredWidth = itemConstraints.preferredWidth;
+    auto maxWidth = itemConstraints.maximumWidth;
+
     auto availableWidth = width();
     // Check if we have a valid width. If we cannot even fit a horizontalSpacing
     // we cannot do anything with the width and most likely did not get a width
@@ -307,45 +332,38 @@ std::tuple<int, int, qreal, qreal> LegendLayout::determineColumns()
         Q_EMIT preferredWidthChanged();
     }
 
-    auto columns = 1;
-    auto rows = itemCount;
-    bool fit = true;
-
-    // Calculate the actual number of rows and columns by trying to fit items
-    // until we find the right number.
-    while (true) {
-        auto minTotalWidth = sizeWithSpacing(columns, minWidth, m_horizontalSpacing);
-        auto maxTotalWidth = sizeWithSpacing(columns, maxWidth, m_horizontalSpacing);
-
-        // If the minimum width is less than our width, but the maximum is
-        // larger, we found a correct solution since we can resize the items to
-        // fit within the provided bounds.
-        if (minTotalWidth <= availableWidth && maxTotalWidth >= availableWidth) {
-            break;
-        }
-
-        // As long as we have more space available than the items' max size,
-        // decrease the number of rows and that way increase the number of
-        // columns we use to place items - unless that results in no rows, as
-        // that means we've reached a state where we simply have more space than
-        // needed.
-        if (maxTotalWidth < availableWidth) {
-            rows--;
-            if (rows >= 1) {
-                columns = std::ceil(itemCount / float(rows));
-            } else {
-                fit = false;
-                break;
-            }
+    auto columnsForRows = [itemCount](int rows) {
+        return int(std::ceil(itemCount / float(rows)));
+    };
+
+    // Using fewer rows means using more columns, which needs more width. Find
+    // the largest number of rows for which the items can be resized to fill
+    // the available width. Since the width needed only increases when using
+    // fewer rows, this can be done using a binary search.
+    auto found = 0;
+    auto low = 1;
+    auto high = itemCount;
+    while (low <= high) {
+        const auto rows = low + (high - low) / 2;
+        if (sizeWithSpacing(columnsForRows(rows), maxWidth, m_horizontalSpacing) >= availableWidth) {
+            found = rows;
+            low = rows + 1;
+        } else {
+            high = rows - 1;
         }
+    }
 
-        // In certain cases, we hit a corner case where decreasing the number of
-        // rows leads to things ending up outside of the item's bounds. If that
-        // happens, increase the number of rows by one and exit the loop.
-        if (minTotalWidth > availableWidth) {
-            rows += 1;
-            columns = std::ceil(itemCount / float(rows));
-            break;
+    // If even a single row does not fill the available width, we simply have
+    // more space than needed.
+    const auto fit = found > 0;
+    auto columns = itemCount;
+    if (fit) {
+        columns = columnsForRows(found);
+
+        // If the items cannot be resized to fit within the available width,
+        // use one more row.
+        if (sizeWithSpacing(columns, minWidth, m_horizontalSpacing) > availableWidth) {
+            columns = columnsForRows(found + 1);
         }
     }
 
@@ -356,9 +374,9 @@ std::tuple<int, int, qreal, qreal> LegendLayout::determineColumns()
 
     // Recalculate the number of rows, otherwise we may end up with "ghost" rows
     // since the items wrapped into a new column, but no all of them.
-    rows = std::ceil(itemCount / float(columns));
+    auto rows = int(std::ceil(itemCount / float(columns)));
 
-    return std::make_tuple(columns, rows, itemWidth, maxHeight);
+    return std::make_tuple(columns, rows, itemWidth, itemConstraints.maximumHeight);
 }
 
 #include "moc_LegendLayout.cpp"
@@ -7,6 +7,9 @@
 #ifndef LEGENDLAYOUT_H
 #define LEGENDLAYOUT_H
 
+#include <optional>
+#include <tuple>
+
 #include <QQuickItem>
 #include <qqmlregistration.h>
 
@@ -77,12 +80,29 @@ protected:
     void itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data) override;
 
 private:
+    struct Constraints {
+        QList<QQuickItem *> items;
+        QList<LegendLayoutAttached *> attached;
+        qreal minimumWidth = 0.0;
+        qreal preferredWidth = 0.0;
+        qreal maximumWidth = 0.0;
+        qreal maximumHeight = 0.0;
+    };
+
+    void invalidateConstraints();
+    const Constraints &constraints();
     std::tuple<int, int, qreal, qreal> determineColumns();
 
     qreal m_horizontalSpacing = 0.0;
     qreal m_verticalSpacing = 0.0;
     qreal m_preferredWidth = 0.0;
 
+    // Size constraints of the child items, only recalculated when one of the
+    // items changes.
+    std::optional<Constraints> m_constraints;
+    // The result of determineColumns() for the current layout.
+    std::tuple<int, int, qreal, qreal> m_layout;
+
     bool m_completed = false;
 };
 
@@ -7,6 +7,9 @@
 
 #include "LegendModel.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "Chart.h"
 #include "datasource/ChartDataSource.h"
 
@@ -68,13 +71,20 @@ void LegendModel::setChart(Chart *newChart)
     }
 
     if (m_chart) {
-        for (const auto &connection : std::as_const(m_connections)) {
-            disconnect(connection);
-        }
-        m_connections.clear();
+        m_chart->disconnect(this);
     }
 
     m_chart = newChart;
+
+    if (m_chart) {
+        connect(m_chart, &Chart::colorSourceChanged, this, &LegendModel::queueUpdate);
+        connect(m_chart, &Chart::nameSourceChanged, this, &LegendModel::queueUpdate);
+        connect(m_chart, &Chart::shortNameSourceChanged, this, &LegendModel::queueUpdate);
+        connect(m_chart, &Chart::valueSourcesChanged, this, &LegendModel::queueUpdate);
+        connect(m_chart, &Chart::indexingModeChanged, this, &LegendModel::queueUpdate);
+        connect(m_chart, &Chart::destroyed, this, &LegendModel::onChartDestroyed);
+    }
+
     queueUpdate();
     Q_EMIT chartChanged();
 }
@@ -116,114 +126,219 @@ void LegendModel::update()
     m_updateQueued = false;
 
     if (!m_chart) {
+        clear();
         return;
     }
 
-    beginResetModel();
-    m_items.clear();
-
-    ChartDataSource *colorSource = m_chart->colorSource();
-    ChartDataSource *nameSource = m_chart->nameSource();
-    ChartDataSource *shortNameSource = m_chart->shortNameSource();
-
-    m_connections.push_back(connect(m_chart, &Chart::colorSourceChanged, this, &LegendModel::queueUpdate, Qt::UniqueConnection));
-    m_connections.push_back(connect(m_chart, &Chart::nameSourceChanged, this, &LegendModel::queueUpdate, Qt::UniqueConnection));
-    m_connections.push_back(connect(m_chart, &Chart::destroyed, this, &LegendModel::onChartDestroyed, Qt::UniqueConnection));
-
-    auto sources = m_chart->valueSources();
-    int itemCount = countItems();
+    connectSources();
+    updateItems();
+}
 
-    std::transform(sources.cbegin(), sources.cend(), std::back_inserter(m_connections), [this](ChartDataSource *source) {
-        return connect(source, &ChartDataSource::dataChanged, this, &LegendModel::queueDataChange, Qt::UniqueConnection);
-    });
+void LegendModel::updateData()
+{
+    m_dataChangeQueued = false;
+    const auto changedSources = std::exchange(m_changedSources, {});
 
-    m_connections.push_back(connect(m_chart, &Chart::valueSourcesChanged, this, &LegendModel::queueUpdate, Qt::UniqueConnection));
+    if (!m_chart) {
+        return;
+    }
 
-    if ((!colorSource && !(nameSource || shortNameSource)) || itemCount <= 0) {
-        endResetModel();
+    // If the number of items changed, items move to different rows, so
+    // compare all of them.
+    const auto previousOffsets = m_sourceOffsets;
+    if (countItems() != int(m_items.size()) || m_sourceOffsets != previousOffsets) {
+        updateItems();
         return;
     }
 
-    if (colorSource) {
-        m_connections.push_back(connect(colorSource, &ChartDataSource::dataChanged, this, &LegendModel::queueDataChange, Qt::UniqueConnection));
+    const auto sources = m_chart->valueSources();
+    const auto fullSources = {m_chart->colorSource(), m_chart->nameSource(), m_chart->shortNameSource()};
+
+    // Otherwise, only update the rows of the sources that changed.
+    for (auto source : changedSources) {
+        // These affect all items.
+        if (std::find(fullSources.begin(), fullSources.end(), source) != fullSources.end()) {
+            updateItems();
+            return;
+        }
+
+        const auto sourceIndex = int(sources.indexOf(source));
+        if (sourceIndex < 0) {
+            continue;
+        }
+
+        switch (m_chart->indexingMode()) {
+        case Chart::IndexSourceValues:
+            // Only the first source provides values.
+            if (sourceIndex == 0) {
+                updateItems();
+                return;
+            }
+            break;
+        case Chart::IndexEachSource:
+            updateRows(sourceIndex, sourceIndex);
+            break;
+        case Chart::IndexAllValues:
+            updateRows(m_sourceOffsets.at(sourceIndex), m_sourceOffsets.at(sourceIndex) + source->itemCount() - 1);
+            break;
+        }
     }
+}
 
-    if (nameSource) {
-        m_connections.push_back(connect(nameSource, &ChartDataSource::dataChanged, this, &LegendModel::queueDataChange, Qt::UniqueConnection));
+void LegendModel::updateItems()
+{
+    auto items = createItems(0, countItems());
+
+    const auto previousCount = int(m_items.size());
+    const auto count = int(items.size());
+
+    // Items are identified by their index, so compare the items that exist
+    // both before and after and only insert or remove the difference.
+    changeItems(0, items, std::min(previousCount, count));
+
+    if (count > previousCount) {
+        beginInsertRows(QModelIndex{}, previousCount, count - 1);
+        std::move(items.begin() + previousCount, items.end(), std::back_inserter(m_items));
+        endInsertRows();
+    } else if (count < previousCount) {
+        beginRemoveRows(QModelIndex{}, count, previousCount - 1);
+        m_items.erase(m_items.begin() + count, m_items.end());
+        endRemoveRows();
     }
+}
 
-    if (shortNameSource) {
-        m_connections.push_back(connect(shortNameSource, &ChartDataSource::dataChanged, this, &LegendModel::queueDataChange, Qt::UniqueConnection));
+void LegendModel::updateRows(int first, int last)
+{
+    if (last < first) {
+        return;
     }
 
-    for (int i = 0; i < itemCount; ++i) {
-        LegendItem item;
-        item.name = nameSource ? nameSource->item(i).toString() : QString();
-        item.shortName = shortNameSource ? shortNameSource->item(i).toString() : QString();
-        item.color = colorSource ? colorSource->item(i).value<QColor>() : QColor();
-        item.value = getValueForItem(i);
-        m_items.push_back(item);
+    const auto count = last - first + 1;
+    auto items = createItems(first, count);
+    if (int(items.size()) != count || last >= int(m_items.size())) {
+        updateItems();
+        return;
     }
 
-    endResetModel();
+    changeItems(first, items, count);
 }
 
-void LegendModel::updateData()
+void LegendModel::changeItems(int first, std::vector<LegendItem> &items, int count)
 {
-    m_dataChangeQueued = false;
+    // Rows that changed next to each other are reported as a single change.
+    int changedFirst = -1;
+    QList<int> changedRoles;
+    auto emitChanged = [&](int last) {
+        if (changedFirst >= 0) {
+            Q_EMIT dataChanged(index(changedFirst, 0), index(last, 0), changedRoles);
+            changedFirst = -1;
+            changedRoles.clear();
+        }
+    };
 
-    if (!m_chart) {
-        return;
+    for (int i = 0; i < count; ++i) {
+        const auto row = first + i;
+        auto &item = m_items[row];
+        auto &newItem = items[i];
+
+        QList<int> roles;
+        if (item.name != newItem.name) {
+            roles << NameRole;
+        }
+        if (item.shortName != newItem.shortName) {
+            roles << ShortNameRole;
+        }
+        if (item.color != newItem.color) {
+            roles << ColorRole;
+        }
+        if (item.value != newItem.value) {
+            roles << ValueRole;
+        }
+
+        if (roles.isEmpty()) {
+            emitChanged(row - 1);
+            continue;
+        }
+
+        item = std::move(newItem);
+
+        if (changedFirst < 0) {
+            changedFirst = row;
+        }
+        for (auto role : std::as_const(roles)) {
+            if (!changedRoles.contains(role)) {
+                changedRoles << role;
+            }
+        }
     }
+    emitChanged(first + count - 1);
+}
+
+std::vector<LegendItem> LegendModel::createItems(int first, int count)
+{
+    std::vector<LegendItem> items;
 
     ChartDataSource *colorSource = m_chart->colorSource();
     ChartDataSource *nameSource = m_chart->nameSource();
     ChartDataSource *shortNameSource = m_chart->shortNameSource();
 
-    auto itemCount = countItems();
-
-    if (itemCount != int(m_items.size())) {
-        // Number of items changed, so trigger a full update
-        queueUpdate();
-        return;
+    if ((!colorSource && !(nameSource || shortNameSource)) || count <= 0) {
+        return items;
     }
 
-    QList<QList<int>> changedRows(itemCount);
+    QList<QColor> colors(count);
+    if (colorSource) {
+        colorSource->readColors(first, count, colors.data());
+    }
 
-    std::for_each(m_items.begin(), m_items.end(), [&, i = 0](LegendItem &item) mutable {
-        auto name = nameSource ? nameSource->item(i).toString() : QString{};
-        if (item.name != name) {
-            item.name = name;
-            changedRows[i] << NameRole;
-        }
+    items.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const auto itemIndex = first + i;
+        LegendItem item;
+        item.name = nameSource ? nameSource->item(itemIndex).toString() : QString();
+        item.shortName = shortNameSource ? shortNameSource->item(itemIndex).toString() : QString();
+        item.color = colors.at(i);
+        item.value = getValueForItem(itemIndex);
+        items.push_back(item);
+    }
 
-        auto shortName = shortNameSource ? shortNameSource->item(i).toString() : QString{};
-        if (item.shortName != shortName) {
-            item.shortName = shortName;
-            changedRows[i] << ShortNameRole;
-        }
+    return items;
+}
 
-        auto color = colorSource ? colorSource->item(i).toString() : QColor{};
-        if (item.color != color) {
-            item.color = color;
-            changedRows[i] << ColorRole;
+void LegendModel::connectSources()
+{
+    QList<ChartDataSource *> sources = m_chart->valueSources();
+    for (auto source : {m_chart->colorSource(), m_chart->nameSource(), m_chart->shortNameSource()}) {
+        if (source && !sources.contains(source)) {
+            sources.append(source);
         }
+    }
 
-        auto value = getValueForItem(i);
-        if (item.value != value) {
-            item.value = value;
-            changedRows[i] << ValueRole;
+    // Only change the connections of sources that were added or removed, so
+    // the connections do not accumulate when the chart changes often.
+    for (auto source : std::as_const(m_connectedSources)) {
+        if (!sources.contains(source)) {
+            source->disconnect(this);
         }
+    }
 
-        i++;
-    });
-
-    for (auto i = 0; i < changedRows.size(); ++i) {
-        auto changedRoles = changedRows.at(i);
-        if (!changedRoles.isEmpty()) {
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), changedRoles);
+    for (auto source : std::as_const(sources)) {
+        if (!m_connectedSources.contains(source)) {
+            connect(source, &ChartDataSource::dataChanged, this, [this, source]() {
+                if (!m_changedSources.contains(source)) {
+                    m_changedSources.append(source);
+                }
+                queueDataChange();
+            });
+            connect(source, &QObject::destroyed, this, [this](QObject *object) {
+                m_connectedSources.removeIf([object](ChartDataSource *source) {
+                    return source == object;
+                });
+            });
         }
     }
+
+    m_connectedSources = sources;
 }
 
 int LegendModel::countItems()
@@ -241,9 +356,14 @@ int LegendModel::countItems()
         itemCount = sources.count();
         break;
     case Chart::IndexAllValues:
-        itemCount = std::accumulate(sources.cbegin(), sources.cend(), 0, [](int current, ChartDataSource *source) -> int {
-            return current + source->itemCount();
-        });
+        // Keep where the items of each source start, so the source of an
+        // item can be found using a binary search.
+        m_sourceOffsets.clear();
+        m_sourceOffsets.reserve(sources.count());
+        for (auto source : std::as_const(sources)) {
+            m_sourceOffsets.append(itemCount);
+            itemCount += source->itemCount();
+        }
         break;
     }
 
@@ -262,27 +382,39 @@ QVariant LegendModel::getValueForItem(int item)
     case Chart::IndexEachSource:
         value = sources.at(item)->first();
         break;
-    case Chart::IndexAllValues:
-        for (auto source : sources) {
-            if (item >= source->itemCount()) {
-                item -= source->itemCount();
-            } else {
-                value = source->item(item);
-                break;
-            }
+    case Chart::IndexAllValues: {
+        auto itr = std::upper_bound(m_sourceOffsets.cbegin(), m_sourceOffsets.cend(), item);
+        if (itr != m_sourceOffsets.cbegin()) {
+            const auto sourceIndex = std::distance(m_sourceOffsets.cbegin(), itr) - 1;
+            value = sources.at(sourceIndex)->item(item - *(itr - 1));
         }
         break;
     }
+    }
 
     return value;
 }
 
+void LegendModel::clear()
+{
+    if (!m_items.empty()) {
+        beginRemoveRows(QModelIndex{}, 0, int(m_items.size()) - 1);
+        m_items.clear();
+        endRemoveRows();
+    }
+
+    for (auto source : std::as_const(m_connectedSources)) {
+        source->disconnect(this);
+    }
+    m_connectedSources.clear();
+    m_changedSources.clear();
+    m_sourceOffsets.clear();
+}
+
 void LegendModel::onChartDestroyed()
 {
-    beginResetModel();
-    m_items.clear();
     m_chart = nullptr;
-    endResetModel();
+    clear();
 }
 
 #include "moc_LegendModel.cpp"
@@ -67,6 +67,12 @@ private:
     void queueDataChange();
     void update();
     void updateData();
+    void connectSources();
+    void updateItems();
+    void updateRows(int first, int last);
+    void changeItems(int first, std::vector<LegendItem> &items, int count);
+    std::vector<LegendItem> createItems(int first, int count);
+    void clear();
     int countItems();
     QVariant getValueForItem(int item);
     void onChartDestroyed();
@@ -75,7 +81,12 @@ private:
     int m_sourceIndex = UseSourceCount;
     bool m_updateQueued = false;
     bool m_dataChangeQueued = false;
-    std::vector<QMetaObject::Connection> m_connections;
+    QList<ChartDataSource *> m_connectedSources;
+    // Sources that changed since the last data update. These may have been
+    // destroyed, so they are only used for comparing.
+    QList<ChartDataSource *> m_changedSources;
+    // The index of the first item of each value source, when indexing all values.
+    QList<int> m_sourceOffsets;
     std::vector<LegendItem> m_items;
 };
 
@@ -7,20 +7,40 @@
 
 #include "LineGridNode.h"
 
-#include <cmath>
+#include <algorithm>
+#include <limits>
 
-#include <QSGFlatColorMaterial>
+#include <QSGVertexColorMaterial>
+
+namespace
+{
+constexpr int VerticesPerLine = 4;
+constexpr int IndicesPerLine = 6;
+
+template<typename T>
+void writeIndices(T *indices, int lineCount)
+{
+    for (int i = 0; i < lineCount; ++i) {
+        const auto vertex = T(i * VerticesPerLine);
+        indices[0] = vertex;
+        indices[1] = vertex + 1;
+        indices[2] = vertex + 2;
+        indices[3] = vertex + 2;
+        indices[4] = vertex + 1;
+        indices[5] = vertex + 3;
+        indices += IndicesPerLine;
+    }
+}
+}
 
 LineGridNode::LineGridNode()
 {
-    m_geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
-    m_geometry->setDrawingMode(QSGGeometry::DrawLines);
-    m_geometry->setLineWidth(m_lineWidth);
+    m_geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0};
+    m_geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    m_geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
     setGeometry(m_geometry);
 
-    m_material = new QSGFlatColorMaterial{};
-    m_material->setColor(QColor(255, 0, 0, 255));
-    setMaterial(m_material);
+    setMaterial(new QSGVertexColorMaterial{});
 
     setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
 }
@@ -29,16 +49,6 @@ LineGridNode::~LineGridNode()
 {
 }
 
-void LineGridNode::setVisible(bool visible)
-{
-    if (visible == m_visible) {
-        return;
-    }
-
-    m_visible = visible;
-    markDirty(QSGNode::DirtySubtreeBlocked);
-}
-
 void LineGridNode::setVertical(bool vertical)
 {
     if (vertical == m_vertical) {
@@ -57,101 +67,100 @@ void LineGridNode::setRect(const QRectF &rect)
     m_rect = rect;
 }
 
-void LineGridNode::setColor(const QColor &color)
-{
-    if (color == m_material->color()) {
-        return;
-    }
-
-    m_material->setColor(color);
-    markDirty(QSGNode::DirtyMaterial);
-}
-
-void LineGridNode::setSpacing(float spacing)
-{
-    if (qFuzzyCompare(spacing, m_spacing)) {
-        return;
-    }
-
-    m_spacing = spacing;
-}
-
-void LineGridNode::setLineWidth(float lineWidth)
-{
-    if (qFuzzyCompare(lineWidth, m_lineWidth)) {
-        return;
-    }
-
-    m_lineWidth = lineWidth;
-    m_geometry->setLineWidth(lineWidth);
-    markDirty(QSGNode::DirtyGeometry);
-}
-
-bool LineGridNode::isSubtreeBlocked() const
+void LineGridNode::setLines(const QList<Lines> &lines)
 {
-    return !m_visible;
+    m_lines = lines;
 }
 
 void LineGridNode::update()
 {
     if (!m_rect.isValid()) {
-        return;
+        m_lines.clear();
     }
 
-    int totalVertices = 0;
-    if (!m_vertical) {
-        totalVertices = std::floor(m_rect.width() / std::ceil(m_spacing)) * 2 + 4;
-    } else {
-        totalVertices = std::floor(m_rect.height() / std::ceil(m_spacing)) * 2 + 4;
+    int lineCount = 0;
+    for (const auto &lines : std::as_const(m_lines)) {
+        lineCount += lines.positions.size();
     }
 
-    if (totalVertices < 4) {
-        return;
+    const auto capacity = m_geometry->vertexCount() / VerticesPerLine;
+    if (lineCount > capacity || lineCount < capacity / 4) {
+        allocate(lineCount);
     }
 
-    if (totalVertices != m_geometry->vertexCount()) {
-        m_geometry->allocate(totalVertices, totalVertices);
+    if (m_geometry->vertexCount() == 0) {
+        return;
     }
 
-    auto vertices = m_geometry->vertexDataAsPoint2D();
-    auto indices = m_geometry->indexDataAsUShort();
-
-    if (!vertices || !indices) {
-        return;
+    auto vertices = m_geometry->vertexDataAsColoredPoint2D();
+
+    const auto length = m_vertical ? m_rect.height() : m_rect.width();
+    const auto start = m_vertical ? m_rect.top() : m_rect.left();
+
+    for (const auto &lines : std::as_const(m_lines)) {
+        const auto color = lines.color.toRgb();
+        const auto alpha = color.alphaF();
+        const auto red = uchar(color.red() * alpha);
+        const auto green = uchar(color.green() * alpha);
+        const auto blue = uchar(color.blue() * alpha);
+        const auto opacity = uchar(color.alpha());
+
+        const auto width = std::clamp(qreal(lines.lineWidth), 0.0, length);
+
+        for (auto position : lines.positions) {
+            // Keep lines at the edges completely inside the grid.
+            const auto from = std::clamp(start + position - width / 2.0, start, start + length - width);
+            const auto to = from + width;
+
+            if (m_vertical) {
+                vertices[0].set(m_rect.left(), from, red, green, blue, opacity);
+                vertices[1].set(m_rect.right(), from, red, green, blue, opacity);
+                vertices[2].set(m_rect.left(), to, red, green, blue, opacity);
+                vertices[3].set(m_rect.right(), to, red, green, blue, opacity);
+            } else {
+                vertices[0].set(from, m_rect.top(), red, green, blue, opacity);
+                vertices[1].set(to, m_rect.top(), red, green, blue, opacity);
+                vertices[2].set(from, m_rect.bottom(), red, green, blue, opacity);
+                vertices[3].set(to, m_rect.bottom(), red, green, blue, opacity);
+            }
+            vertices += VerticesPerLine;
+        }
     }
 
-    int index = 0;
-    if (m_vertical) {
-        line(vertices, indices, index, m_rect.left(), m_rect.top(), m_rect.right(), m_rect.top());
+    // Lines beyond the current count are kept for later updates, collapse
+    // them so they are not rendered.
+    const auto end = m_geometry->vertexDataAsColoredPoint2D() + m_geometry->vertexCount();
+    std::fill(vertices, end, QSGGeometry::ColoredPoint2D{});
 
-        auto y = m_spacing;
-        for (auto i = 0; i < (totalVertices - 4) / 2; ++i) {
-            line(vertices, indices, index, m_rect.left(), y, m_rect.right(), y);
-            y += m_spacing;
-        }
+    m_geometry->markVertexDataDirty();
+    markDirty(QSGNode::DirtyGeometry);
+}
 
-        line(vertices, indices, index, m_rect.left(), m_rect.bottom(), m_rect.right(), m_rect.bottom());
-    } else {
-        line(vertices, indices, index, m_rect.left(), m_rect.top(), m_rect.left(), m_rect.bottom());
+void LineGridNode::allocate(int lineCount)
+{
+    // Leave some room to grow, so small changes in the amount of lines do not
+    // need a new allocation.
+    const auto capacity = lineCount > 0 ? lineCount + lineCount / 2 : 0;
+    const auto vertexCount = capacity * VerticesPerLine;
+    const auto indexCount = capacity * IndicesPerLine;
+
+    // 16-bit indices can only address 65536 vertices.
+    const auto indexType = vertexCount > std::numeric_limits<quint16>::max() + 1 ? QSGGeometry::UnsignedIntType : QSGGeometry::UnsignedShortType;
+    if (indexType != m_geometry->indexType()) {
+        m_geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0, 0, indexType};
+        m_geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        m_geometry->setVertexDataPattern(QSGGeometry::DynamicPattern);
+        setGeometry(m_geometry);
+    }
 
-        auto x = m_spacing;
-        for (auto i = 0; i < (totalVertices - 4) / 2; ++i) {
-            line(vertices, indices, index, x, m_rect.top(), x, m_rect.bottom());
-            x += m_spacing;
-        }
+    m_geometry->allocate(vertexCount, indexCount);
 
-        line(vertices, indices, index, m_rect.right(), m_rect.top(), m_rect.right(), m_rect.bottom());
+    if (indexType == QSGGeometry::UnsignedIntType) {
+        writeIndices(m_geometry->indexDataAsUInt(), capacity);
+    } else {
+        writeIndices(m_geometry->indexDataAsUShort(), capacity);
     }
 
-    m_geometry->markVertexDataDirty();
     m_geometry->markIndexDataDirty();
     markDirty(QSGNode::DirtyGeometry);
 }
-
-void LineGridNode::line(QSGGeometry::Point2D *vertices, quint16 *indices, int &index, qreal fromX, qreal fromY, qreal toX, qreal toY)
-{
-    indices[index] = index;
-    vertices[index++].set(fromX, fromY);
-    indices[index] = index;
-    vertices[index++].set(toX, toY);
-}
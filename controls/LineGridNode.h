@@ -9,41 +9,44 @@
 #define LINEGRIDNODE_H
 
 #include <QColor>
+#include <QList>
 #include <QSGGeometryNode>
 
-class QSGFlatColorMaterial;
-
 /**
- * @todo write docs
+ * A node that renders several sets of parallel lines as a single geometry.
+ *
+ * Lines are rendered as thin quads with a vertex color, so each set of lines
+ * can have its own color and width. The geometry is only reallocated when it
+ * needs to grow or becomes a lot smaller than needed, otherwise it is updated
+ * in place.
  */
 class LineGridNode : public QSGGeometryNode
 {
 public:
+    struct Lines {
+        QList<float> positions;
+        QColor color;
+        float lineWidth = 1.0;
+    };
+
     LineGridNode();
     ~LineGridNode();
 
-    void setVisible(bool visible);
     void setVertical(bool vertical);
     void setRect(const QRectF &rect);
-    void setColor(const QColor &color);
-    void setSpacing(float spacing);
-    void setLineWidth(float lineWidth);
-
-    bool isSubtreeBlocked() const override;
+    // Sets of lines to render, later sets are rendered on top of earlier ones.
+    void setLines(const QList<Lines> &lines);
 
     void update();
 
 private:
-    void line(QSGGeometry::Point2D *vertices, quint16 *indices, int &index, qreal fromX, qreal fromY, qreal toX, qreal toY);
+    void allocate(int lineCount);
 
     QSGGeometry *m_geometry = nullptr;
-    QSGFlatColorMaterial *m_material = nullptr;
 
-    bool m_visible = true;
     bool m_vertical = false;
     QRectF m_rect;
-    float m_spacing = 1.0;
-    float m_lineWidth = 1.0;
+    QList<Lines> m_lines;
 };
 
 #endif // LINEGRIDNODE_H
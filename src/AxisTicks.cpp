@@ -0,0 +1,170 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "AxisTicks.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+constexpr qreal Second = 1000.0;
+constexpr qreal Minute = 60.0 * Second;
+constexpr qreal Hour = 60.0 * Minute;
+constexpr qreal Day = 24.0 * Hour;
+
+// Allow for some rounding error, so values that are exactly on a step are not
+// skipped.
+constexpr qreal Epsilon = 1e-9;
+
+struct TimeStep {
+    qreal step;
+    qreal minorStep;
+};
+
+// Steps for times of a second or more. Smaller steps use numbers of
+// milliseconds.
+constexpr std::array<TimeStep, 20> TimeSteps = {{
+    {Second, 200.0},
+    {2.0 * Second, 500.0},
+    {5.0 * Second, Second},
+    {10.0 * Second, 2.0 * Second},
+    {15.0 * Second, 5.0 * Second},
+    {30.0 * Second, 10.0 * Second},
+    {Minute, 15.0 * Second},
+    {2.0 * Minute, 30.0 * Second},
+    {5.0 * Minute, Minute},
+    {10.0 * Minute, 2.0 * Minute},
+    {15.0 * Minute, 5.0 * Minute},
+    {30.0 * Minute, 10.0 * Minute},
+    {Hour, 15.0 * Minute},
+    {2.0 * Hour, 30.0 * Minute},
+    {3.0 * Hour, Hour},
+    {6.0 * Hour, Hour},
+    {12.0 * Hour, 3.0 * Hour},
+    {Day, 6.0 * Hour},
+    {2.0 * Day, 12.0 * Hour},
+    {7.0 * Day, Day},
+}};
+
+qreal niceNumber(qreal minimum)
+{
+    const auto magnitude = std::pow(10.0, std::floor(std::log10(minimum)));
+    const auto normalized = minimum / magnitude;
+
+    for (auto factor : {1.0, 2.0, 5.0}) {
+        if (normalized <= factor * (1.0 + Epsilon)) {
+            return factor * magnitude;
+        }
+    }
+    return 10.0 * magnitude;
+}
+
+qreal niceMinorNumber(qreal major)
+{
+    const auto magnitude = std::pow(10.0, std::floor(std::log10(major)));
+    // Steps of two are divided in four, so minor steps are still nice.
+    return std::round(major / magnitude) == 2.0 ? major / 4.0 : major / 5.0;
+}
+
+QList<qreal> multiplesBetween(qreal start, qreal end, qreal step)
+{
+    // Adding 0.0 turns -0.0 into 0.0, which would otherwise end up as "-0"
+    // in labels.
+    const auto first = std::ceil(start / step - Epsilon) + 0.0;
+    const auto last = std::floor(end / step + Epsilon);
+
+    // Multiplying fractional steps introduces rounding errors, like 0.1 * 3
+    // resulting in 0.30000000000000004, so round them to the precision of
+    // the step.
+    const auto scale = step < 1.0 ? std::pow(10.0, std::ceil(-std::log10(step)) + 1.0) : 1.0;
+
+    QList<qreal> result;
+    result.reserve(std::max(last - first + 1.0, 0.0));
+    for (auto i = first; i <= last; ++i) {
+        result.append(step < 1.0 ? std::round(i * step * scale) / scale : i * step);
+    }
+    return result;
+}
+}
+
+AxisTicks AxisTicks::calculate(qreal start, qreal end, int maximumCount, Unit unit)
+{
+    AxisTicks result;
+
+    if (start > end) {
+        std::swap(start, end);
+    }
+
+    const auto distance = end - start;
+    if (maximumCount < 1 || !std::isfinite(distance)) {
+        return result;
+    }
+
+    if (distance <= 0.0) {
+        result.major = {start};
+        return result;
+    }
+
+    // With a step of distance / (count - 1), count ticks fit if the first tick
+    // is exactly at start, so this never results in more than count ticks.
+    result.majorStep = niceStep(maximumCount > 1 ? distance / (maximumCount - 1) : distance * 2.0, unit);
+    result.minorStep = minorStepFor(result.majorStep, unit);
+    result.major = multiplesBetween(start, end, result.majorStep);
+
+    if (result.minorStep > 0.0) {
+        const auto ratio = qRound64(result.majorStep / result.minorStep);
+        const auto first = qint64(std::ceil(start / result.minorStep - Epsilon));
+        const auto minor = multiplesBetween(start, end, result.minorStep);
+
+        result.minor.reserve(minor.size());
+        for (int i = 0; i < minor.size(); ++i) {
+            if ((first + i) % ratio != 0) {
+                result.minor.append(minor.at(i));
+            }
+        }
+    }
+
+    return result;
+}
+
+qreal AxisTicks::niceStep(qreal minimumStep, Unit unit)
+{
+    if (!(minimumStep > 0.0) || !std::isfinite(minimumStep)) {
+        return 0.0;
+    }
+
+    if (unit == Unit::Time && minimumStep > Second / 2.0) {
+        for (const auto &timeStep : TimeSteps) {
+            if (minimumStep <= timeStep.step) {
+                return timeStep.step;
+            }
+        }
+        return Day * niceNumber(minimumStep / Day);
+    }
+
+    return niceNumber(minimumStep);
+}
+
+qreal AxisTicks::minorStepFor(qreal majorStep, Unit unit)
+{
+    if (!(majorStep > 0.0) || !std::isfinite(majorStep)) {
+        return 0.0;
+    }
+
+    if (unit == Unit::Time && majorStep >= Second) {
+        for (const auto &timeStep : TimeSteps) {
+            if (qFuzzyCompare(majorStep, timeStep.step)) {
+                return timeStep.minorStep;
+            }
+        }
+        return Day * niceMinorNumber(majorStep / Day);
+    }
+
+    return niceMinorNumber(majorStep);
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include <QList>
+
+#include "quickcharts_export.h"
+
+/*
+ * The values at which to place ticks, such as labels and grid lines, on an axis.
+ *
+ * Ticks are placed at multiples of a "nice" step: one, two or five times a
+ * power of ten for numbers, or a common unit of time such as 15 seconds or 6
+ * hours for times. Major ticks are placed at multiples of the major step,
+ * minor ticks at multiples of the smaller minor step that are not major ticks.
+ */
+struct QUICKCHARTS_EXPORT AxisTicks {
+    enum class Unit {
+        Number,
+        // Values are times in milliseconds. Steps of a day or longer are
+        // aligned to UTC midnight.
+        Time,
+    };
+
+    qreal majorStep = 0.0;
+    qreal minorStep = 0.0;
+    QList<qreal> major;
+    QList<qreal> minor;
+
+    /*
+     * Calculate ticks between start and end, inclusive, with at most
+     * maximumCount major ticks.
+     */
+    static AxisTicks calculate(qreal start, qreal end, int maximumCount, Unit unit = Unit::Number);
+
+    /*
+     * The smallest nice step that is at least minimumStep.
+     */
+    static qreal niceStep(qreal minimumStep, Unit unit = Unit::Number);
+
+    /*
+     * A nice step that evenly divides majorStep, to use for minor ticks.
+     */
+    static qreal minorStepFor(qreal majorStep, Unit unit = Unit::Number);
+};
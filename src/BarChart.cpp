@@ -6,6 +6,10 @@
 
 #include "BarChart.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <QDebug>
 #include <QSGNode>
 
@@ -18,6 +22,8 @@ BarChart::BarChart(QQuickItem *parent)
 {
 }
 
+BarChart::~BarChart() = default;
+
 qreal BarChart::spacing() const
 {
     return m_spacing;
@@ -139,7 +145,9 @@ QSGNode *BarChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDat
         static_cast<QSGTransformNode *>(node)->setMatrix(matrix);
         barNode->setRect(QRectF{boundingRect().topLeft(), QSizeF{height(), width()}});
     }
-    barNode->setBars(calculateBars());
+    m_bars = calculateBars();
+    m_barsPerItem = valueSources().size();
+    barNode->setBars(m_bars);
     barNode->setRadius(m_radius);
     barNode->setBackgroundColor(m_backgroundColor);
 
@@ -148,7 +156,26 @@ QSGNode *BarChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDat
     return node;
 }
 
+QVariantMap BarChart::itemAt(qreal x, qreal y) const
+{
+    return itemResultForBar(findBar(QPointF{x, y}, false));
+}
+
+QVariantMap BarChart::nearestItem(qreal x, qreal y) const
+{
+    return itemResultForBar(findBar(QPointF{x, y}, true));
+}
+
 void BarChart::onDataChanged()
+{
+    XYChart::onDataChanged();
+
+    // Multiple sources may change at the same time, for example when they are
+    // sampled on the same interval, so only recalculate once before rendering.
+    polish();
+}
+
+void BarChart::updatePolish()
 {
     if (valueSources().size() == 0 || !colorSource()) {
         return;
@@ -159,41 +186,43 @@ void BarChart::onDataChanged()
     updateComputedRange();
 
     const auto range = computedRange();
+    const auto &computed = computedValues();
     const auto sources = valueSources();
-    auto colors = colorSource();
     auto indexMode = indexingMode();
+
+    QList<QColor> colors(colorSource()->itemCount());
+    colorSource()->readColors(0, colors.size(), colors.data());
+
     auto colorIndex = 0;
 
     m_barDataItems.fill(QList<BarData>{}, range.distanceX);
 
     const auto highlightIndex = highlight();
 
-    auto generator = [&, this, i = range.startX]() mutable -> QList<BarData> {
+    auto generator = [&, this, i = 0]() mutable -> QList<BarData> {
         QList<BarData> colorInfos;
+        colorInfos.reserve(sources.count());
+
+        auto base = 0.0;
+        if (!computed.baseline.isEmpty()) {
+            base = (computed.baseline.at(i) - range.startY) / range.distanceY;
+        }
 
         for (int j = 0; j < sources.count(); ++j) {
-            auto value = (sources.at(j)->item(i).toReal() - range.startY) / range.distanceY;
-            auto color = colors->item(colorIndex).value<QColor>();
+            auto value = (computed.value(j, i) - range.startY) / range.distanceY;
+            auto color = colors.value(colorIndex);
 
             if (highlightIndex >= 0 && highlightIndex != colorIndex) {
                 color = desaturate(color);
             }
 
-            colorInfos << BarData{value, color};
+            colorInfos << BarData{value, color, base};
 
             if (indexMode != Chart::IndexSourceValues) {
                 colorIndex++;
             }
         }
 
-        if (stacked()) {
-            auto previous = 0.0;
-            for (auto &[colorVal, _] : colorInfos) {
-                colorVal += previous;
-                previous = colorVal;
-            }
-        }
-
         if (indexMode == Chart::IndexSourceValues) {
             colorIndex++;
         } else if (indexMode == Chart::IndexEachSource) {
@@ -234,12 +263,12 @@ QList<Bar> BarChart::calculateBars()
             result.reserve(result.size() + items.size());
             if (stacked()) {
                 std::transform(items.crbegin(), items.crend(), std::back_inserter(result), [x, w](const BarData &entry) {
-                    return Bar{x, w, float(entry.value), entry.color};
+                    return Bar{x, w, float(entry.value), entry.color, float(entry.base)};
                 });
                 x += itemSpacing;
             } else {
                 std::transform(items.cbegin(), items.cend(), std::back_inserter(result), [&x, itemSpacing, w](const BarData &entry) {
-                    Bar bar{x, w, float(entry.value), entry.color};
+                    Bar bar{x, w, float(entry.value), entry.color, float(entry.base)};
                     x += itemSpacing;
                     return bar;
                 });
@@ -253,7 +282,7 @@ QList<Bar> BarChart::calculateBars()
             for (const auto &items : std::as_const(m_barDataItems)) {
                 result.reserve(result.size() + items.size());
                 std::transform(items.crbegin(), items.crend(), std::back_inserter(result), [x, w](const BarData &entry) {
-                    return Bar{x, w, float(entry.value), entry.color};
+                    return Bar{x, w, float(entry.value), entry.color, float(entry.base)};
                 });
 
                 x += itemSpacing;
@@ -267,7 +296,7 @@ QList<Bar> BarChart::calculateBars()
                 result.reserve(result.size() + items.size());
                 for (int i = 0; i < items.count(); ++i) {
                     auto entry = items.at(i);
-                    result << Bar{float(x + i * (m_barWidth + m_spacing)), w, float(entry.value), entry.color};
+                    result << Bar{float(x + i * (m_barWidth + m_spacing)), w, float(entry.value), entry.color, float(entry.base)};
                 }
                 x += itemSpacing;
             }
@@ -277,4 +306,81 @@ QList<Bar> BarChart::calculateBars()
     return result;
 }
 
+int BarChart::findBar(const QPointF &position, bool nearest) const
+{
+    if (m_bars.isEmpty()) {
+        return -1;
+    }
+
+    // Bars are positioned along the width of the chart and grow from the
+    // bottom when vertical. When horizontal, they are rotated to be positioned
+    // along the height and grow from the left.
+    const auto vertical = m_orientation == VerticalOrientation;
+    const auto along = float(vertical ? position.x() : position.y());
+    const auto offset = float(vertical ? height() - position.y() : position.x());
+    const auto length = float(vertical ? height() : width());
+
+    auto distance = [along, offset, length](const Bar &bar) {
+        const auto dx = std::max({bar.x - along, along - (bar.x + bar.width), 0.0f});
+        const auto start = std::min(bar.base, bar.value) * length;
+        const auto end = std::max(bar.base, bar.value) * length;
+        const auto dy = std::max({start - offset, offset - end, 0.0f});
+        return std::hypot(dx, dy);
+    };
+
+    // Bars are ordered by their position, with stacked bars sharing the same
+    // position, so the bars at a position can be found using a binary search.
+    auto itr = std::upper_bound(m_bars.cbegin(), m_bars.cend(), along, [](float along, const Bar &bar) {
+        return along < bar.x;
+    });
+    const auto after = int(std::distance(m_bars.cbegin(), itr));
+
+    if (!nearest) {
+        // Later bars are drawn on top of earlier bars, so search backwards.
+        for (int i = after - 1; i >= 0 && m_bars.at(i).x + m_bars.at(i).width >= along; --i) {
+            if (distance(m_bars.at(i)) <= 0.0f) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // The nearest bar is one of the bars at the position before or after the
+    // requested position.
+    auto first = std::max(after - 1, 0);
+    while (first > 0 && m_bars.at(first - 1).x == m_bars.at(first).x) {
+        first--;
+    }
+    auto last = std::min(after, int(m_bars.size()) - 1);
+    while (last < m_bars.size() - 1 && m_bars.at(last + 1).x == m_bars.at(last).x) {
+        last++;
+    }
+
+    int result = -1;
+    auto resultDistance = std::numeric_limits<float>::max();
+    for (int i = first; i <= last; ++i) {
+        const auto barDistance = distance(m_bars.at(i));
+        if (barDistance <= resultDistance) {
+            result = i;
+            resultDistance = barDistance;
+        }
+    }
+    return result;
+}
+
+QVariantMap BarChart::itemResultForBar(int bar) const
+{
+    if (bar < 0 || m_barsPerItem <= 0) {
+        return QVariantMap{};
+    }
+
+    // Each item has a bar for each source, in reverse order when stacked.
+    const auto item = bar / m_barsPerItem;
+    const auto source = stacked() ? m_barsPerItem - 1 - bar % m_barsPerItem : bar % m_barsPerItem;
+
+    const auto range = computedRange();
+    const auto itemIndex = direction() == Direction::ZeroAtStart ? item : range.distanceX - 1 - item;
+    return itemResult(source, range.startX + itemIndex);
+}
+
 #include "moc_BarChart.cpp"
@@ -62,6 +62,7 @@ public:
     Q_ENUM(Orientation)
 
     explicit BarChart(QQuickItem *parent = nullptr);
+    ~BarChart() override;
 
     /*!
      * \qmlproperty real BarChart::spacing
@@ -123,12 +124,18 @@ public:
     void setBackgroundColor(const QColor &newBackgroundColor);
     Q_SIGNAL void backgroundColorChanged();
 
+    QVariantMap itemAt(qreal x, qreal y) const override;
+    QVariantMap nearestItem(qreal x, qreal y) const override;
+
 protected:
     QSGNode *updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *) override;
     void onDataChanged() override;
+    void updatePolish() override;
 
 private:
     QList<Bar> calculateBars();
+    int findBar(const QPointF &position, bool nearest) const;
+    QVariantMap itemResultForBar(int bar) const;
 
     qreal m_spacing = 0.0;
     qreal m_barWidth = AutoWidth;
@@ -138,8 +145,12 @@ private:
     struct BarData {
         qreal value = 0;
         QColor color;
+        qreal base = 0;
     };
     QList<QList<BarData>> m_barDataItems;
+    // The bars that were last rendered, used to find the item at a position.
+    QList<Bar> m_bars;
+    int m_barsPerItem = 0;
     QColor m_backgroundColor = Qt::transparent;
 };
 
@@ -169,6 +169,20 @@ void Chart::resetHighlight()
     setHighlight(-1);
 }
 
+QVariantMap Chart::itemAt(qreal x, qreal y) const
+{
+    Q_UNUSED(x);
+    Q_UNUSED(y);
+    return QVariantMap{};
+}
+
+QVariantMap Chart::nearestItem(qreal x, qreal y) const
+{
+    Q_UNUSED(x);
+    Q_UNUSED(y);
+    return QVariantMap{};
+}
+
 void Chart::componentComplete()
 {
     QQuickItem::componentComplete();
@@ -182,6 +196,20 @@ QColor Chart::desaturate(const QColor &input)
     return color.convertTo(QColor::Rgb);
 }
 
+QVariantMap Chart::itemResult(int sourceIndex, int itemIndex) const
+{
+    auto source = m_valueSources.value(sourceIndex);
+    if (!source) {
+        return QVariantMap{};
+    }
+
+    return QVariantMap{
+        {QStringLiteral("sourceIndex"), sourceIndex},
+        {QStringLiteral("itemIndex"), itemIndex},
+        {QStringLiteral("value"), source->item(itemIndex)},
+    };
+}
+
 void Chart::appendSource(Chart::DataSourcesProperty *list, ChartDataSource *source)
 {
     auto chart = reinterpret_cast<Chart *>(list->data);
@@ -118,6 +118,30 @@ public:
     void resetHighlight();
     Q_SIGNAL void highlightChanged();
 
+    /*!
+     * \qmlmethod var Chart::itemAt(real x, real y)
+     * \brief Find the item that is drawn at a position.
+     *
+     * The position is in the chart's coordinates. This returns an object with
+     * the properties \c sourceIndex, the index of the value source,
+     * \c itemIndex, the index of the item in that value source, and \c value,
+     * the value of that item. If there is no item at the position, an empty
+     * object is returned.
+     *
+     * This uses the geometry the chart calculated for rendering, so it is
+     * cheap enough to call for every mouse move.
+     */
+    Q_INVOKABLE virtual QVariantMap itemAt(qreal x, qreal y) const;
+    /*!
+     * \qmlmethod var Chart::nearestItem(real x, real y)
+     * \brief Find the item that is drawn nearest to a position.
+     *
+     * This returns the same as itemAt(), except that an item is returned even
+     * if no item is drawn at the position. An empty object is only returned if
+     * the chart has no items.
+     */
+    Q_INVOKABLE virtual QVariantMap nearestItem(qreal x, qreal y) const;
+
     Q_SIGNAL void dataChanged();
 
 protected:
@@ -141,6 +165,11 @@ protected:
      */
     QColor desaturate(const QColor &input);
 
+    /*!
+     * \brief Create the result of itemAt() and nearestItem() for an item.
+     */
+    QVariantMap itemResult(int sourceIndex, int itemIndex) const;
+
 private:
     static void appendSource(DataSourcesProperty *list, ChartDataSource *source);
     static qsizetype sourceCount(DataSourcesProperty *list);
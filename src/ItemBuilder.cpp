@@ -11,7 +11,8 @@
 class ItemIncubator : public QQmlIncubator
 {
 public:
-    ItemIncubator(QQmlComponent *component, QQmlContext *context)
+    ItemIncubator(QQmlComponent *component, QQmlContext *context, QQmlIncubator::IncubationMode mode)
+        : QQmlIncubator(mode)
     {
         m_component = component;
         m_context = context;
@@ -171,7 +172,7 @@ void ItemBuilder::build(QQuickItem *parent)
 
     for (int i = 0; i < m_count; ++i) {
         auto context = m_context ? m_context : qmlContext(m_component);
-        auto incubator = std::make_unique<ItemIncubator>(m_component, context);
+        auto incubator = std::make_unique<ItemIncubator>(m_component, context, m_incubationMode);
 
         incubator->setStateCallback([this, parent, i](QQuickItem *item) {
             item->setParentItem(parent);
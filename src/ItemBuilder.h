@@ -64,7 +64,7 @@ private:
     QQmlContext *m_context = nullptr;
     int m_count = 0;
     int m_completed = 0;
-    QQmlIncubator::IncubationMode m_incubationMode = QQmlIncubator::IncubationMode::AsynchronousIfNested;
+    QQmlIncubator::IncubationMode m_incubationMode = QQmlIncubator::IncubationMode::Asynchronous;
     QVariantMap m_initialProperties;
 
     std::vector<std::unique_ptr<ItemIncubator>> m_incubators;
@@ -7,17 +7,26 @@
 
 #include "LineChart.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
 
+#include <QLineF>
 #include <QPainter>
 #include <QPainterPath>
 #include <QQuickWindow>
+#include <QSGClipNode>
 
+#include "ItemBuilder.h"
 #include "RangeGroup.h"
 #include "datasource/ChartDataSource.h"
 #include "scenegraph/LineChartNode.h"
 
 static const float PixelsPerStep = 2.0;
+// The amount of unused point delegates that is always kept for reuse.
+static const int MinimumPointDelegatePoolSize = 16;
 
 
 QList<QVector2D> interpolatePoints(const QList<QVector2D> &points, float height);
@@ -108,6 +117,11 @@ LineChart::LineChart(QQuickItem *parent)
 {
 }
 
+LineChart::~LineChart()
+{
+    clearPointDelegates();
+}
+
 bool LineChart::interpolate() const
 {
     return m_interpolate;
@@ -184,14 +198,74 @@ void LineChart::setPointDelegate(QQmlComponent *newPointDelegate)
     }
 
     m_pointDelegate = newPointDelegate;
-    for (auto entry : std::as_const(m_pointDelegates)) {
-        qDeleteAll(entry);
-    }
-    m_pointDelegates.clear();
+    clearPointDelegates();
     polish();
     Q_EMIT pointDelegateChanged();
 }
 
+LineChart::PointDelegateMode LineChart::pointDelegateMode() const
+{
+    return m_pointDelegateMode;
+}
+
+void LineChart::setPointDelegateMode(PointDelegateMode newPointDelegateMode)
+{
+    if (newPointDelegateMode == m_pointDelegateMode) {
+        return;
+    }
+
+    m_pointDelegateMode = newPointDelegateMode;
+    updatePointDelegates();
+    Q_EMIT pointDelegateModeChanged();
+}
+
+QPointF LineChart::pointDelegatePosition() const
+{
+    return m_pointDelegatePosition;
+}
+
+void LineChart::setPointDelegatePosition(const QPointF &newPointDelegatePosition)
+{
+    if (newPointDelegatePosition == m_pointDelegatePosition) {
+        return;
+    }
+
+    m_pointDelegatePosition = newPointDelegatePosition;
+    // Only the delegates change, so there is no need to recalculate the points.
+    if (m_pointDelegateMode == NearPosition) {
+        updatePointDelegates();
+    }
+    Q_EMIT pointDelegatePositionChanged();
+}
+
+qreal LineChart::pointDelegateDistance() const
+{
+    return m_pointDelegateDistance;
+}
+
+void LineChart::setPointDelegateDistance(qreal newPointDelegateDistance)
+{
+    if (qFuzzyCompare(newPointDelegateDistance, m_pointDelegateDistance)) {
+        return;
+    }
+
+    m_pointDelegateDistance = newPointDelegateDistance;
+    if (m_pointDelegateMode == NearPosition) {
+        updatePointDelegates();
+    }
+    Q_EMIT pointDelegateDistanceChanged();
+}
+
+QVariantMap LineChart::itemAt(qreal x, qreal y) const
+{
+    return findItem(QPointF{x, y}, m_pointDelegateDistance);
+}
+
+QVariantMap LineChart::nearestItem(qreal x, qreal y) const
+{
+    return findItem(QPointF{x, y}, std::numeric_limits<qreal>::infinity());
+}
+
 void LineChart::updatePolish()
 {
     if (m_rangeInvalid) {
@@ -199,56 +273,47 @@ void LineChart::updatePolish()
         m_rangeInvalid = false;
     }
 
-    QList<QVector2D> previousValues;
-
     const auto range = computedRange();
+    const auto &computed = computedValues();
     const auto sources = valueSources();
-    for (int i = 0; i < sources.size(); ++i) {
-        auto valueSource = sources.at(i);
+    const float stepSize = width() / (range.distanceX - 1);
 
-        float stepSize = width() / (range.distanceX - 1);
-        QList<QVector2D> values(range.distanceX);
-        auto generator = [&, i = range.startX]() mutable -> QVector2D {
+    auto generatePoints = [&](auto valueAt) {
+        QList<QVector2D> points(range.distanceX);
+        auto generator = [&, item = 0]() mutable -> QVector2D {
             float value = 0;
             if (range.distanceY != 0) {
-                value = (valueSource->item(i).toFloat() - range.startY) / range.distanceY;
+                value = (valueAt(item) - range.startY) / range.distanceY;
+            }
+
+            float x = item * stepSize;
+            if (!computed.xValues.isEmpty() && range.distanceXValue != 0) {
+                x = (computed.xValues.at(item) - range.startXValue) / range.distanceXValue * width();
             }
 
-            auto result = QVector2D{direction() == Direction::ZeroAtStart ? i * stepSize : float(boundingRect().right()) - i * stepSize, value};
-            i++;
+            auto result = QVector2D{direction() == Direction::ZeroAtStart ? x : float(boundingRect().right()) - x, value};
+            item++;
             return result;
         };
 
         if (direction() == Direction::ZeroAtStart) {
-            std::generate_n(values.begin(), range.distanceX, generator);
+            std::generate_n(points.begin(), range.distanceX, generator);
         } else {
-            std::generate_n(values.rbegin(), range.distanceX, generator);
+            std::generate_n(points.rbegin(), range.distanceX, generator);
         }
 
-        if (stacked() && !previousValues.isEmpty()) {
-            if (values.size() != previousValues.size()) {
-                qWarning() << "Value source" << valueSource->objectName()
-                           << "has a different number of elements from the previous source. Ignoring stacking for this source.";
-            } else {
-                std::for_each(values.begin(), values.end(), [previousValues, i = 0](QVector2D &point) mutable {
-                    point.setY(point.y() + previousValues.at(i++).y());
-                });
-            }
-        }
-        previousValues = values;
-
-        if (m_pointDelegate) {
-            auto &delegates = m_pointDelegates[valueSource];
-            if (delegates.size() != values.size()) {
-                qDeleteAll(delegates);
-                createPointDelegates(values, i);
-            } else {
-                for (int item = 0; item < values.size(); ++item) {
-                    auto delegate = delegates.at(item);
-                    updatePointDelegate(delegate, values.at(item), valueSource->item(item), i);
-                }
-            }
-        }
+        return points;
+    };
+
+    m_points.clear();
+    for (int i = 0; i < sources.size(); ++i) {
+        auto valueSource = sources.at(i);
+
+        auto values = generatePoints([&computed, i](int item) {
+            return computed.value(i, item);
+        });
+
+        m_points.insert(valueSource, values);
 
         if (m_interpolate) {
             m_values[valueSource] = interpolatePoints(values, height());
@@ -257,14 +322,17 @@ void LineChart::updatePolish()
         }
     }
 
-    const auto pointKeys = m_pointDelegates.keys();
-    for (auto key : pointKeys) {
-        if (!sources.contains(key)) {
-            qDeleteAll(m_pointDelegates[key]);
-            m_pointDelegates.remove(key);
-        }
+    if (!computed.baseline.isEmpty()) {
+        auto baseline = generatePoints([&computed](int item) {
+            return computed.baseline.at(item);
+        });
+        m_baseline = m_interpolate ? interpolatePoints(baseline, height()) : baseline;
+    } else {
+        m_baseline.clear();
     }
 
+    updatePointDelegates();
+
     update();
 }
 
@@ -276,16 +344,30 @@ QSGNode *LineChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
         node = new QSGNode();
     }
 
+    auto lineParent = updateBaselineClip(node);
+
     const auto highlightIndex = highlight();
     const auto sources = valueSources();
+
+    QList<QColor> colors(sources.size(), QColor{Qt::black});
+    if (colorSource()) {
+        colorSource()->readColors(0, colors.size(), colors.data());
+    }
+
+    QList<QColor> fillColors;
+    if (m_fillColorSource) {
+        fillColors.resize(sources.size());
+        m_fillColorSource->readColors(0, fillColors.size(), fillColors.data());
+    }
+
     for (int i = 0; i < sources.size(); ++i) {
         int childIndex = sources.size() - 1 - i;
-        while (childIndex >= node->childCount()) {
-            node->appendChildNode(new LineChartNode{});
+        while (childIndex >= lineParent->childCount()) {
+            lineParent->appendChildNode(new LineChartNode{});
         }
-        auto lineNode = static_cast<LineChartNode *>(node->childAtIndex(childIndex));
-        auto color = colorSource() ? colorSource()->item(i).value<QColor>() : Qt::black;
-        auto fillColor = m_fillColorSource ? m_fillColorSource->item(i).value<QColor>() : colorWithAlpha(color, m_fillOpacity);
+        auto lineNode = static_cast<LineChartNode *>(lineParent->childAtIndex(childIndex));
+        auto color = colors.at(i);
+        auto fillColor = m_fillColorSource ? fillColors.at(i) : colorWithAlpha(color, m_fillOpacity);
         auto lineWidth = i == highlightIndex ? std::max(m_lineWidth, 3.0) : m_lineWidth;
 
         if (highlightIndex >= 0 && i != highlightIndex) {
@@ -296,11 +378,11 @@ QSGNode *LineChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
         updateLineNode(lineNode, sources.at(i), color, fillColor, lineWidth);
     }
 
-    while (node->childCount() > sources.size()) {
+    while (lineParent->childCount() > sources.size()) {
         // removeChildNode unfortunately does not take care of deletion so we
         // need to handle this manually.
-        auto lastNode = node->childAtIndex(node->childCount() - 1);
-        node->removeChildNode(lastNode);
+        auto lastNode = lineParent->childAtIndex(lineParent->childCount() - 1);
+        lineParent->removeChildNode(lastNode);
         delete lastNode;
     }
 
@@ -308,9 +390,9 @@ QSGNode *LineChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
         // Move highlighted node to the end to ensure we always show the
         // highlighted chart on top. This is done after the above removal to
         // ensure we don't suddenly remove the highlighted node.
-        auto highlightNode = node->childAtIndex(node->childCount() - 1 - highlightIndex);
-        node->removeChildNode(highlightNode);
-        node->appendChildNode(highlightNode);
+        auto highlightNode = lineParent->childAtIndex(lineParent->childCount() - 1 - highlightIndex);
+        lineParent->removeChildNode(highlightNode);
+        lineParent->appendChildNode(highlightNode);
     }
 
     return node;
@@ -318,6 +400,8 @@ QSGNode *LineChart::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeDa
 
 void LineChart::onDataChanged()
 {
+    XYChart::onDataChanged();
+
     m_rangeInvalid = true;
     polish();
 }
@@ -330,6 +414,69 @@ void LineChart::geometryChange(const QRectF &newGeometry, const QRectF &oldGeome
     }
 }
 
+QSGNode *LineChart::updateBaselineClip(QSGNode *node)
+{
+    QSGClipNode *clipNode = nullptr;
+    if (node->childCount() > 0 && node->firstChild()->type() == QSGNode::ClipNodeType) {
+        clipNode = static_cast<QSGClipNode *>(node->firstChild());
+    }
+
+    if (m_baseline.size() < 2) {
+        if (clipNode) {
+            // This also deletes the line nodes, they will be recreated as
+            // children of node.
+            node->removeChildNode(clipNode);
+            delete clipNode;
+        }
+        return node;
+    }
+
+    if (!clipNode) {
+        while (node->childCount() > 0) {
+            auto child = node->firstChild();
+            node->removeChildNode(child);
+            delete child;
+        }
+
+        clipNode = new QSGClipNode{};
+        clipNode->setIsRectangular(false);
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangleStrip);
+        clipNode->setGeometry(geometry);
+        clipNode->setFlag(QSGNode::OwnsGeometry);
+        node->appendChildNode(clipNode);
+    }
+
+    // Anything below the baseline should stay empty, so clip the lines to a
+    // strip that goes from the baseline to above the top of the chart. The
+    // strip is extended by the line width to avoid cutting off line ends.
+    auto geometry = clipNode->geometry();
+    if (geometry->vertexCount() != m_baseline.size() * 2) {
+        geometry->allocate(m_baseline.size() * 2);
+    }
+
+    const auto rect = boundingRect();
+    const float top = rect.top() - rect.height();
+    auto vertices = geometry->vertexDataAsPoint2D();
+    for (int i = 0; i < m_baseline.size(); ++i) {
+        const auto point = m_baseline.at(i);
+        auto x = point.x();
+        if (i == 0) {
+            x -= m_lineWidth;
+        } else if (i == m_baseline.size() - 1) {
+            x += m_lineWidth;
+        }
+
+        vertices[i * 2].set(x, top);
+        vertices[i * 2 + 1].set(x, rect.top() + (1.0 - point.y()) * rect.height());
+    }
+
+    clipNode->setClipRect(rect.adjusted(-m_lineWidth, top - rect.top(), m_lineWidth, 0.0));
+    clipNode->markDirty(QSGNode::DirtyGeometry);
+
+    return clipNode;
+}
+
 void LineChart::updateLineNode(LineChartNode *node, ChartDataSource *valueSource, const QColor &lineColor, const QColor &fillColor, qreal lineWidth)
 {
     if (window()) {
@@ -347,29 +494,135 @@ void LineChart::updateLineNode(LineChartNode *node, ChartDataSource *valueSource
     node->updatePoints();
 }
 
-void LineChart::createPointDelegates(const QList<QVector2D> &values, int sourceIndex)
+void LineChart::updatePointDelegates()
 {
-    auto valueSource = valueSources().at(sourceIndex);
+    const auto sources = valueSources();
 
-    QList<QQuickItem *> delegates;
-    for (int i = 0; i < values.size(); ++i) {
-        auto delegate = qobject_cast<QQuickItem *>(m_pointDelegate->beginCreate(qmlContext(m_pointDelegate)));
-        if (!delegate) {
-            qWarning() << "Delegate creation for point" << i << "of value source" << valueSource->objectName()
-                       << "failed, make sure pointDelegate is a QQuickItem";
-            delegate = new QQuickItem(this);
+    const auto pointKeys = m_pointDelegates.keys();
+    for (auto key : pointKeys) {
+        if (!m_points.contains(key)) {
+            const auto delegates = m_pointDelegates.take(key);
+            for (auto delegate : delegates) {
+                releasePointDelegate(std::move(delegate));
+            }
         }
+    }
 
-        delegate->setParent(this);
-        delegate->setParentItem(this);
-        updatePointDelegate(delegate, values.at(i), valueSource->item(i), sourceIndex);
+    if (!m_pointDelegate) {
+        return;
+    }
+
+    const auto startX = computedRange().startX;
+
+    int missing = 0;
+    int used = 0;
+    for (int i = 0; i < sources.size(); ++i) {
+        auto valueSource = sources.at(i);
+        const auto points = m_points.value(valueSource);
+
+        auto previous = m_pointDelegates.take(valueSource);
+        auto &delegates = m_pointDelegates[valueSource];
+
+        const auto indices = pointDelegateIndices(points);
+        for (auto item : indices) {
+            auto delegate = previous.take(item);
+            if (!delegate) {
+                if (m_pointDelegatePool.isEmpty()) {
+                    missing++;
+                    continue;
+                }
 
-        m_pointDelegate->completeCreate();
+                delegate = m_pointDelegatePool.takeLast();
+                delegate->setVisible(true);
+            }
+
+            updatePointDelegate(delegate.get(), points.at(item), valueSource->item(startX + item), i);
+            delegates.insert(item, delegate);
+        }
 
-        delegates.append(delegate);
+        for (auto itr = previous.begin(); itr != previous.end(); ++itr) {
+            releasePointDelegate(std::move(itr.value()));
+        }
+
+        used += delegates.size();
     }
 
-    m_pointDelegates.insert(valueSource, delegates);
+    // Keep enough unused delegates around for the amount of delegates in use
+    // to change, but destroy the rest so a chart that needed a lot of
+    // delegates once does not keep them forever.
+    const auto poolSize = std::max(used, MinimumPointDelegatePoolSize);
+    if (m_pointDelegatePool.size() > poolSize) {
+        m_pointDelegatePool.resize(poolSize);
+    }
+
+    if (missing > 0) {
+        createPointDelegates(missing);
+    }
+}
+
+QList<int> LineChart::pointDelegateIndices(const QList<QVector2D> &points) const
+{
+    if (points.isEmpty()) {
+        return {};
+    }
+
+    // Points are ordered by their x position, so the points within a range of
+    // x positions can be found using a binary search.
+    auto lowerIndex = [&points](qreal x) {
+        auto itr = std::lower_bound(points.cbegin(), points.cend(), x, [](const QVector2D &point, qreal x) {
+            return point.x() < x;
+        });
+        return int(std::distance(points.cbegin(), itr));
+    };
+    auto upperIndex = [&points](qreal x) {
+        auto itr = std::upper_bound(points.cbegin(), points.cend(), x, [](qreal x, const QVector2D &point) {
+            return x < point.x();
+        });
+        return int(std::distance(points.cbegin(), itr));
+    };
+
+    // Points outside of the chart do not need a delegate. Allow a small
+    // margin for rounding errors at the edges.
+    const auto first = lowerIndex(-1.0);
+    const auto last = upperIndex(width() + 1.0);
+
+    QList<int> result;
+    if (first >= last) {
+        return result;
+    }
+
+    switch (m_pointDelegateMode) {
+    case AllPoints:
+        result.resize(last - first);
+        std::iota(result.begin(), result.end(), first);
+        break;
+    case NearPosition: {
+        if (!boundingRect().contains(m_pointDelegatePosition)) {
+            break;
+        }
+
+        const auto start = std::max(lowerIndex(m_pointDelegatePosition.x() - m_pointDelegateDistance), first);
+        const auto end = std::min(upperIndex(m_pointDelegatePosition.x() + m_pointDelegateDistance), last);
+        for (int i = start; i < end; ++i) {
+            const auto point = QPointF{points.at(i).x(), (1.0 - points.at(i).y()) * height()};
+            if (QLineF{point, m_pointDelegatePosition}.length() <= m_pointDelegateDistance) {
+                result.append(i);
+            }
+        }
+        break;
+    }
+    case ExtremePoints: {
+        auto [minimum, maximum] = std::minmax_element(points.cbegin() + first, points.cbegin() + last, [](const QVector2D &left, const QVector2D &right) {
+            return left.y() < right.y();
+        });
+        result = {first, int(std::distance(points.cbegin(), minimum)), int(std::distance(points.cbegin(), maximum)), last - 1};
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        break;
+    }
+    }
+
+    return result;
 }
 
 void LineChart::updatePointDelegate(QQuickItem *delegate, const QVector2D &position, const QVariant &value, int sourceIndex)
@@ -377,7 +630,10 @@ void LineChart::updatePointDelegate(QQuickItem *delegate, const QVector2D &posit
     auto pos = QPointF{position.x() - delegate->width() / 2, (1.0 - position.y()) * height() - delegate->height() / 2};
     delegate->setPosition(pos);
 
-    auto color = colorSource() ? colorSource()->item(sourceIndex).value<QColor>() : QColor();
+    QColor color;
+    if (colorSource()) {
+        colorSource()->readColors(sourceIndex, 1, &color);
+    }
     auto highlightIndex = highlight();
     if (highlightIndex >= 0) {
         if (sourceIndex == highlightIndex) {
@@ -396,6 +652,119 @@ void LineChart::updatePointDelegate(QQuickItem *delegate, const QVector2D &posit
     attached->setShortName(shortNameSource() ? shortNameSource()->item(sourceIndex).toString() : QString{});
 }
 
+void LineChart::createPointDelegates(int count)
+{
+    // Only create one batch of delegates at a time. Once the batch is
+    // finished, polishing again will request any delegates still missing.
+    if (m_pointDelegateBuilder) {
+        return;
+    }
+
+    m_pointDelegateBuilder = std::make_unique<ItemBuilder>();
+    m_pointDelegateBuilder->setComponent(m_pointDelegate);
+    m_pointDelegateBuilder->setContext(qmlContext(m_pointDelegate));
+    m_pointDelegateBuilder->setCount(count);
+    m_pointDelegateBuilder->setIncubationMode(QQmlIncubator::Asynchronous);
+    m_pointDelegateBuilder->setInitialProperties({{QStringLiteral("visible"), false}});
+
+    connect(m_pointDelegateBuilder.get(), &ItemBuilder::finished, this, [this, builder = m_pointDelegateBuilder.get()]() {
+        // The builder is still in use while emitting finished, so delay
+        // moving the delegates to the pool.
+        QMetaObject::invokeMethod(
+            this,
+            [this, builder]() {
+                // The builder may have been cleared and replaced by a new one
+                // that is still building before this is called.
+                if (m_pointDelegateBuilder.get() != builder || !builder->isFinished()) {
+                    return;
+                }
+
+                const auto items = m_pointDelegateBuilder->items();
+                for (const auto &item : items) {
+                    if (!item) {
+                        qWarning() << "Delegate creation for points failed, make sure pointDelegate is a QQuickItem";
+                        auto fallback = std::make_shared<QQuickItem>();
+                        fallback->setParentItem(this);
+                        fallback->setVisible(false);
+                        m_pointDelegatePool.append(fallback);
+                        continue;
+                    }
+                    m_pointDelegatePool.append(item);
+                }
+
+                m_pointDelegateBuilder.reset();
+                polish();
+            },
+            Qt::QueuedConnection);
+    });
+
+    m_pointDelegateBuilder->build(this);
+}
+
+void LineChart::releasePointDelegate(std::shared_ptr<QQuickItem> &&delegate)
+{
+    if (!delegate) {
+        return;
+    }
+
+    delegate->setVisible(false);
+    m_pointDelegatePool.append(std::move(delegate));
+}
+
+void LineChart::clearPointDelegates()
+{
+    m_pointDelegateBuilder.reset();
+    m_pointDelegates.clear();
+    m_pointDelegatePool.clear();
+}
+
+QVariantMap LineChart::findItem(const QPointF &position, qreal maximumDistance) const
+{
+    const auto sources = valueSources();
+
+    int foundSource = -1;
+    int foundPoint = -1;
+    auto foundDistance = maximumDistance;
+
+    for (int i = 0; i < sources.size(); ++i) {
+        const auto points = m_points.value(sources.at(i));
+
+        auto check = [&](int index) {
+            const auto point = QPointF{points.at(index).x(), (1.0 - points.at(index).y()) * height()};
+            const auto distance = QLineF{point, position}.length();
+            // Later sources are drawn on top of earlier sources, so prefer them.
+            if (distance <= foundDistance) {
+                foundSource = i;
+                foundPoint = index;
+                foundDistance = distance;
+            }
+        };
+
+        // Points are ordered by their x position, so start at the position and
+        // search outwards until points are further away horizontally than the
+        // nearest point so far.
+        auto itr = std::lower_bound(points.cbegin(), points.cend(), position.x(), [](const QVector2D &point, qreal x) {
+            return point.x() < x;
+        });
+        const auto start = int(std::distance(points.cbegin(), itr));
+
+        for (int index = start; index < points.size() && points.at(index).x() - position.x() <= foundDistance; ++index) {
+            check(index);
+        }
+        for (int index = start - 1; index >= 0 && position.x() - points.at(index).x() <= foundDistance; --index) {
+            check(index);
+        }
+    }
+
+    if (foundSource < 0) {
+        return QVariantMap{};
+    }
+
+    const auto pointCount = m_points.value(sources.at(foundSource)).size();
+    const auto item = direction() == Direction::ZeroAtStart ? foundPoint : pointCount - 1 - foundPoint;
+    return itemResult(foundSource, computedRange().startX + item);
+}
+
 // Smoothly interpolate between points, using monotonic cubic interpolation.
 QList<QVector2D> interpolatePoints(const QList<QVector2D> &points, float height)
 {
@@ -407,8 +776,8 @@ QList<QVector2D> interpolatePoints(const QList<QVector2D> &points, float height)
 
     QList<QVector2D> result;
 
-    auto current = QVector2D{0.0, points.first().y() * height};
-    result.append(QVector2D{0.0, points.first().y()});
+    auto current = QVector2D{points.first().x(), points.first().y() * height};
+    result.append(points.first());
 
     for (int i = 0; i < points.size() - 1; ++i) {
         auto next = QVector2D{points.at(i + 1).x(), points.at(i + 1).y() * height};
@@ -14,6 +14,7 @@
 
 #include "XYChart.h"
 
+class ItemBuilder;
 class LineChartNode;
 
 /*
@@ -90,7 +91,29 @@ class QUICKCHARTS_EXPORT LineChart : public XYChart
     QML_ATTACHED(LineChartAttached)
 
 public:
+    /*!
+     * \enum LineChart::PointDelegateMode
+     *
+     * Which points get a point delegate.
+     *
+     * \value AllPoints
+     *        All points within the chart get a delegate.
+     * \value NearPosition
+     *        Only points within \l pointDelegateDistance of
+     *        \l pointDelegatePosition get a delegate.
+     * \value ExtremePoints
+     *        Only the first, last, lowest and highest point within the chart
+     *        get a delegate.
+     */
+    enum PointDelegateMode {
+        AllPoints,
+        NearPosition,
+        ExtremePoints,
+    };
+    Q_ENUM(PointDelegateMode)
+
     explicit LineChart(QQuickItem *parent = nullptr);
+    ~LineChart() override;
 
     /*!
      * \qmlproperty bool LineChart::interpolate
@@ -140,6 +163,10 @@ public:
      * chart. Each instance will have access to the attached properties of
      * LineChartAttached through LineChart attached object.
      *
+     * Delegates are created asynchronously and reused when the number of
+     * points changes. Points that are outside of the chart do not get a
+     * delegate.
+     *
      * \note The component assigned to this property is expected to create a
      *       QQuickItem, since the created object needs to be positioned.
      */
@@ -147,6 +174,56 @@ public:
     QQmlComponent *pointDelegate() const;
     void setPointDelegate(QQmlComponent *newPointDelegate);
     Q_SIGNAL void pointDelegateChanged();
+    /*!
+     * \qmlproperty enumeration LineChart::pointDelegateMode
+     * \qmlenumeratorsfrom LineChart::PointDelegateMode
+     * \brief Which points get a point delegate.
+     *
+     * For charts with many points, creating a delegate for each point is
+     * expensive. This can be used to only create delegates for the points
+     * that are of interest, for example to display a tooltip for the points
+     * near the mouse cursor.
+     *
+     * \note Finding points is done assuming points are ordered by their X
+     *       value, which may not be the case when using an unordered
+     *       xValueSource.
+     *
+     * The default is LineChart.AllPoints.
+     */
+    Q_PROPERTY(PointDelegateMode pointDelegateMode READ pointDelegateMode WRITE setPointDelegateMode NOTIFY pointDelegateModeChanged)
+    PointDelegateMode pointDelegateMode() const;
+    void setPointDelegateMode(PointDelegateMode newPointDelegateMode);
+    Q_SIGNAL void pointDelegateModeChanged();
+    /*!
+     * \qmlproperty point LineChart::pointDelegatePosition
+     * \brief The position to find points near when pointDelegateMode is LineChart.NearPosition.
+     *
+     * This is in the chart's coordinates. When it is outside of the chart, no
+     * points get a delegate. For example, this can be bound to the position
+     * of a HoverHandler.
+     *
+     * The default is (-1, -1).
+     */
+    Q_PROPERTY(QPointF pointDelegatePosition READ pointDelegatePosition WRITE setPointDelegatePosition NOTIFY pointDelegatePositionChanged)
+    QPointF pointDelegatePosition() const;
+    void setPointDelegatePosition(const QPointF &newPointDelegatePosition);
+    Q_SIGNAL void pointDelegatePositionChanged();
+    /*!
+     * \qmlproperty real LineChart::pointDelegateDistance
+     * \brief The maximum distance, in pixels, of points to pointDelegatePosition.
+     *
+     * This is also the maximum distance of points to the position passed to
+     * itemAt().
+     *
+     * The default is 10.
+     */
+    Q_PROPERTY(qreal pointDelegateDistance READ pointDelegateDistance WRITE setPointDelegateDistance NOTIFY pointDelegateDistanceChanged)
+    qreal pointDelegateDistance() const;
+    void setPointDelegateDistance(qreal newPointDelegateDistance);
+    Q_SIGNAL void pointDelegateDistanceChanged();
+
+    QVariantMap itemAt(qreal x, qreal y) const override;
+    QVariantMap nearestItem(qreal x, qreal y) const override;
 
     static LineChartAttached *qmlAttachedProperties(QObject *object)
     {
@@ -160,9 +237,15 @@ protected:
     void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
 
 private:
+    QSGNode *updateBaselineClip(QSGNode *node);
     void updateLineNode(LineChartNode *node, ChartDataSource *valueSource, const QColor &lineColor, const QColor &fillColor, qreal lineWidth);
-    void createPointDelegates(const QList<QVector2D> &values, int sourceIndex);
+    void updatePointDelegates();
+    QList<int> pointDelegateIndices(const QList<QVector2D> &points) const;
     void updatePointDelegate(QQuickItem *delegate, const QVector2D &position, const QVariant &value, int sourceIndex);
+    void createPointDelegates(int count);
+    void releasePointDelegate(std::shared_ptr<QQuickItem> &&delegate);
+    void clearPointDelegates();
+    QVariantMap findItem(const QPointF &position, qreal maximumDistance) const;
 
     bool m_interpolate = false;
     qreal m_lineWidth = 1.0;
@@ -170,8 +253,19 @@ private:
     bool m_rangeInvalid = true;
     ChartDataSource *m_fillColorSource = nullptr;
     QHash<ChartDataSource *, QList<QVector2D>> m_values;
+    QList<QVector2D> m_baseline;
     QQmlComponent *m_pointDelegate = nullptr;
-    QHash<ChartDataSource *, QList<QQuickItem *>> m_pointDelegates;
+    PointDelegateMode m_pointDelegateMode = AllPoints;
+    QPointF m_pointDelegatePosition = QPointF{-1.0, -1.0};
+    qreal m_pointDelegateDistance = 10.0;
+    // Points before interpolation, used to position point delegates and to
+    // find the item at a position.
+    QHash<ChartDataSource *, QList<QVector2D>> m_points;
+    // Point delegates for each source, indexed by point.
+    QHash<ChartDataSource *, QHash<int, std::shared_ptr<QQuickItem>>> m_pointDelegates;
+    // Delegates that are currently not used, ready to be reused.
+    QList<std::shared_ptr<QQuickItem>> m_pointDelegatePool;
+    std::unique_ptr<ItemBuilder> m_pointDelegateBuilder;
 };
 
 #endif // LINECHART_H
@@ -7,8 +7,13 @@
 
 #include "PieChart.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <QAbstractItemModel>
 #include <QDebug>
+#include <QtMath>
 
 #include "datasource/ChartDataSource.h"
 #include "scenegraph/PieChartNode.h"
@@ -137,6 +142,16 @@ void PieChart::setSmoothEnds(bool newSmoothEnds)
     Q_EMIT smoothEndsChanged();
 }
 
+QVariantMap PieChart::itemAt(qreal x, qreal y) const
+{
+    return findItem(QPointF{x, y}, false);
+}
+
+QVariantMap PieChart::nearestItem(qreal x, qreal y) const
+{
+    return findItem(QPointF{x, y}, true);
+}
+
 QSGNode *PieChart::updatePaintNode(QSGNode *node, UpdatePaintNodeData *data)
 {
     Q_UNUSED(data);
@@ -184,9 +199,18 @@ QSGNode *PieChart::updatePaintNode(QSGNode *node, UpdatePaintNodeData *data)
 }
 
 void PieChart::onDataChanged()
+{
+    // Multiple sources may change at the same time, for example when they are
+    // sampled on the same interval, so only recalculate once before rendering.
+    polish();
+}
+
+void PieChart::updatePolish()
 {
     m_sections.clear();
     m_colors.clear();
+    m_sectionEnds.clear();
+    m_sectionItems.clear();
 
     const auto sources = valueSources();
     const auto colors = colorSource();
@@ -203,6 +227,9 @@ void PieChart::onDataChanged()
         return std::max(result, source->maximum().toDouble());
     };
 
+    QList<QColor> colorValues(colors->itemCount());
+    colors->readColors(0, colorValues.size(), colorValues.data());
+
     auto indexMode = indexingMode();
     auto colorIndex = 0;
     const auto highlightIndex = highlight();
@@ -217,6 +244,7 @@ void PieChart::onDataChanged()
 
         QList<qreal> sections;
         QList<QColor> sectionColors;
+        QList<int> sectionItems;
 
         for (int i = 0; i < source->itemCount(); ++i) {
             auto value = source->item(i).toReal();
@@ -227,9 +255,10 @@ void PieChart::onDataChanged()
                 }
 
                 sections << limited;
+                sectionItems << i;
                 total += limited;
 
-                auto color = colors->item(colorIndex).value<QColor>();
+                auto color = colorValues.value(colorIndex);
 
                 if (highlightIndex >= 0 && highlightIndex != colorIndex) {
                     color = desaturate(color);
@@ -246,16 +275,27 @@ void PieChart::onDataChanged()
 
         if (qFuzzyCompare(total, 0.0)) {
             m_sections << QList<qreal>{0.0};
-            m_colors << QList<QColor>{colors->item(colorIndex).value<QColor>()};
-        }
+            m_colors << QList<QColor>{colorValues.value(colorIndex)};
+            m_sectionEnds << QList<qreal>{};
+            m_sectionItems << QList<int>{};
+        } else {
+            // Keep where each section ends, so the section at an angle can be
+            // found using a binary search.
+            QList<qreal> sectionEnds;
+            sectionEnds.reserve(sections.size());
+            qreal end = 0.0;
+            for (auto &value : sections) {
+                value = value / range.distance;
+                end += value;
+                sectionEnds << end;
+            }
 
-        for (auto &value : sections) {
-            value = value / range.distance;
+            m_sections << sections;
+            m_colors << sectionColors;
+            m_sectionEnds << sectionEnds;
+            m_sectionItems << sectionItems;
         }
 
-        m_sections << sections;
-        m_colors << sectionColors;
-
         if (indexMode == IndexEachSource) {
             colorIndex++;
         } else if (indexMode == IndexSourceValues) {
@@ -266,4 +306,57 @@ void PieChart::onDataChanged()
     update();
 }
 
+QVariantMap PieChart::findItem(const QPointF &position, bool nearest) const
+{
+    const auto delta = position - boundingRect().center();
+    const auto radius = std::hypot(delta.x(), delta.y());
+
+    // Find the ring at the position. This uses the same radii as
+    // updatePaintNode(), which are relative to half the size of the chart.
+    const auto ringCount = m_sectionEnds.size();
+    int ring = -1;
+    auto ringDistance = std::numeric_limits<qreal>::max();
+    auto outerRadius = std::min(width(), height()) / 2.0;
+    for (int i = 0; i < ringCount; ++i) {
+        const auto innerRadius = i == ringCount - 1 && m_filled ? 0.0 : outerRadius - m_thickness;
+        const auto distance = std::max({innerRadius - radius, radius - outerRadius, 0.0});
+        if (distance < ringDistance && !m_sectionEnds.at(i).isEmpty()) {
+            ring = i;
+            ringDistance = distance;
+        }
+        outerRadius = innerRadius - m_spacing;
+    }
+
+    const auto totalAngle = m_toAngle - m_fromAngle;
+    if (ring < 0 || (!nearest && ringDistance > 0.0) || qFuzzyIsNull(totalAngle)) {
+        return QVariantMap{};
+    }
+
+    // Angles start at the top and increase clockwise, or counter-clockwise if
+    // toAngle is smaller than fromAngle.
+    const auto angle = qRadiansToDegrees(std::atan2(delta.x(), -delta.y()));
+    auto offset = std::fmod(totalAngle < 0.0 ? m_fromAngle - angle : angle - m_fromAngle, 360.0);
+    if (offset < 0.0) {
+        offset += 360.0;
+    }
+    const auto fraction = offset / std::abs(totalAngle);
+
+    const auto &sectionEnds = m_sectionEnds.at(ring);
+    auto itr = std::upper_bound(sectionEnds.cbegin(), sectionEnds.cend(), fraction);
+    if (itr == sectionEnds.cend()) {
+        if (!nearest) {
+            return QVariantMap{};
+        }
+
+        // The position is past the last section, use whichever of the first
+        // and last section is closer.
+        const auto afterLast = (fraction - sectionEnds.last()) * std::abs(totalAngle);
+        const auto beforeFirst = 360.0 - offset;
+        itr = afterLast <= beforeFirst ? sectionEnds.cend() - 1 : sectionEnds.cbegin();
+    }
+
+    const auto section = int(std::distance(sectionEnds.cbegin(), itr));
+    return itemResult(ring, m_sectionItems.at(ring).at(section));
+}
+
 #include "moc_PieChart.cpp"
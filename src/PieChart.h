@@ -154,11 +154,17 @@ public:
     void setSmoothEnds(bool newSmoothEnds);
     Q_SIGNAL void smoothEndsChanged();
 
+    QVariantMap itemAt(qreal x, qreal y) const override;
+    QVariantMap nearestItem(qreal x, qreal y) const override;
+
 protected:
     QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *data) override;
     void onDataChanged() override;
+    void updatePolish() override;
 
 private:
+    QVariantMap findItem(const QPointF &position, bool nearest) const;
+
     std::unique_ptr<RangeGroup> m_range;
     bool m_filled = false;
     qreal m_thickness = 10.0;
@@ -170,6 +176,9 @@ private:
 
     QList<QList<qreal>> m_sections;
     QList<QList<QColor>> m_colors;
+    // Where each section ends and which item it displays, per value source.
+    QList<QList<qreal>> m_sectionEnds;
+    QList<QList<int>> m_sectionItems;
 };
 
 #endif // PIECHART_H
@@ -7,21 +7,43 @@
 
 #include "XYChart.h"
 
+#include <cmath>
+
 #include "RangeGroup.h"
 #include "datasource/ChartDataSource.h"
 
 bool operator==(const ComputedRange &first, const ComputedRange &second)
 {
-    return first.startX == second.startX && first.endX == second.endX && qFuzzyCompare(first.startY, second.startY) && qFuzzyCompare(first.endY, second.endY);
+    return first.startX == second.startX && first.endX == second.endX && qFuzzyCompare(first.startXValue, second.startXValue)
+        && qFuzzyCompare(first.endXValue, second.endXValue) && qFuzzyCompare(first.startY, second.startY) && qFuzzyCompare(first.endY, second.endY);
+}
+
+// Binary search for the first item of a sorted source that is not less than
+// value, or greater than value if upper is true.
+static int findItem(ChartDataSource *source, qreal value, bool upper)
+{
+    int first = 0;
+    int count = source->itemCount();
+    while (count > 0) {
+        const int step = count / 2;
+        const auto itemValue = source->item(first + step).toDouble();
+        if (upper ? itemValue <= value : itemValue < value) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
 }
 
 XYChart::XYChart(QQuickItem *parent)
     : Chart(parent)
 {
     m_xRange = new RangeGroup{this};
-    connect(m_xRange, &RangeGroup::rangeChanged, this, &XYChart::updateComputedRange);
+    connect(m_xRange, &RangeGroup::rangeChanged, this, &XYChart::onRangeChanged);
     m_yRange = new RangeGroup{this};
-    connect(m_yRange, &RangeGroup::rangeChanged, this, &XYChart::updateComputedRange);
+    connect(m_yRange, &RangeGroup::rangeChanged, this, &XYChart::onRangeChanged);
 }
 
 RangeGroup *XYChart::xRange() const
@@ -52,18 +74,68 @@ void XYChart::setDirection(XYChart::Direction newDirection)
 
 bool XYChart::stacked() const
 {
-    return m_stacked;
+    return m_stackingMode != StackingMode::NotStacked;
 }
 
 void XYChart::setStacked(bool newStacked)
 {
-    if (newStacked == m_stacked) {
+    if (newStacked == stacked()) {
         return;
     }
 
-    m_stacked = newStacked;
+    setStackingMode(newStacked ? StackingMode::Stacked : StackingMode::NotStacked);
+}
+
+XYChart::StackingMode XYChart::stackingMode() const
+{
+    return m_stackingMode;
+}
+
+void XYChart::setStackingMode(StackingMode newStackingMode)
+{
+    if (newStackingMode == m_stackingMode) {
+        return;
+    }
+
+    const bool wasStacked = stacked();
+
+    m_stackingMode = newStackingMode;
     onDataChanged();
-    Q_EMIT stackedChanged();
+    Q_EMIT stackingModeChanged();
+
+    if (stacked() != wasStacked) {
+        Q_EMIT stackedChanged();
+    }
+}
+
+ChartDataSource *XYChart::xValueSource() const
+{
+    return m_xValueSource;
+}
+
+void XYChart::setXValueSource(ChartDataSource *newXValueSource)
+{
+    if (newXValueSource == m_xValueSource) {
+        return;
+    }
+
+    if (m_xValueSource) {
+        m_xValueSource->disconnect(this);
+    }
+
+    m_xValueSource = newXValueSource;
+
+    if (m_xValueSource) {
+        connect(m_xValueSource, &ChartDataSource::dataChanged, this, &XYChart::dataChanged);
+        connect(m_xValueSource, &QObject::destroyed, this, [this]() {
+            m_xValueSource = nullptr;
+            Q_EMIT dataChanged();
+            Q_EMIT xValueSourceChanged();
+        });
+    }
+
+    Q_EMIT dataChanged();
+    Q_EMIT xValueSourceChanged();
 }
 
 ComputedRange XYChart::computedRange() const
@@ -79,40 +151,77 @@ void XYChart::updateComputedRange()
 
     ComputedRange result;
 
-    auto xRange = m_xRange->calculateRange(
-        valueSources(),
-        [](ChartDataSource *) {
-            return 0;
-        },
-        [](ChartDataSource *source) {
-            return source->itemCount();
-        });
-    result.startX = xRange.start;
-    result.endX = xRange.end;
-    result.distanceX = xRange.distance;
+    if (m_xValueSource) {
+        auto xRange = m_xRange->calculateRange(
+            {m_xValueSource},
+            [](ChartDataSource *source) {
+                return source->minimum().toDouble();
+            },
+            [](ChartDataSource *source) {
+                return source->maximum().toDouble();
+            });
+        result.startXValue = xRange.start;
+        result.endXValue = xRange.end;
+        result.distanceXValue = xRange.distance;
+
+        // Since X values are sorted, only the items within the X range need to
+        // be considered, which can be found without visiting every item.
+        result.startX = findItem(m_xValueSource, xRange.start, false);
+        result.endX = findItem(m_xValueSource, xRange.end, true);
+        result.distanceX = result.endX - result.startX;
+    } else {
+        auto xRange = m_xRange->calculateRange(
+            valueSources(),
+            [](ChartDataSource *) {
+                return 0;
+            },
+            [](ChartDataSource *source) {
+                return source->itemCount();
+            });
+        result.startX = xRange.start;
+        result.endX = xRange.end;
+        result.distanceX = xRange.distance;
+        result.startXValue = result.startX;
+        result.endXValue = result.endX;
+        result.distanceXValue = result.distanceX;
+    }
 
-    auto maximumY = [this, xRange](ChartDataSource *source) {
-        if (!m_stacked) {
+    updateComputedValues(result.startX, result.distanceX);
+
+    // When stacking, the bounds are known from computing the values, so there
+    // is no need to query the sources again.
+    auto minimumY = [this](ChartDataSource *source) {
+        switch (m_stackingMode) {
+        case StackingMode::NotStacked:
+            return std::min(0.0, source->minimum().toDouble());
+        case StackingMode::Stacked:
+            return std::min(0.0, m_computedValues.minimum);
+        case StackingMode::Percentage:
+            return 0.0;
+        case StackingMode::Centered:
+            return -std::max(std::abs(m_computedValues.minimum), std::abs(m_computedValues.maximum));
+        case StackingMode::Wiggle:
+            return m_computedValues.minimum;
+        }
+        return 0.0;
+    };
+
+    auto maximumY = [this](ChartDataSource *source) {
+        switch (m_stackingMode) {
+        case StackingMode::NotStacked:
             return source->maximum().toDouble();
-        } else {
-            qreal max = std::numeric_limits<qreal>::min();
-            for (int i = xRange.start; i < xRange.end; ++i) {
-                qreal yDistance = 0.0;
-                for (auto source : valueSources()) {
-                    yDistance += source->item(i).toDouble();
-                }
-                max = std::max(max, yDistance);
-            }
-            return max;
+        case StackingMode::Percentage:
+            return 1.0;
+        case StackingMode::Centered:
+            return std::max(std::abs(m_computedValues.minimum), std::abs(m_computedValues.maximum));
+        case StackingMode::Stacked:
+        case StackingMode::Wiggle:
+            return m_computedValues.maximum;
         }
+        return 0.0;
     };
 
-    auto yRange = m_yRange->calculateRange(
-        valueSources(),
-        [](ChartDataSource *source) {
-            return std::min(0.0, source->minimum().toDouble());
-        },
-        maximumY);
+    auto yRange = m_yRange->calculateRange(valueSources(), minimumY, maximumY);
     result.startY = yRange.start;
     result.endY = yRange.end;
     result.distanceY = yRange.distance;
@@ -120,6 +229,27 @@ void XYChart::updateComputedRange()
     setComputedRange(result);
 }
 
+void XYChart::onDataChanged()
+{
+    if (!m_keepFetchedValues) {
+        m_fetchedValid = false;
+    }
+}
+
+void XYChart::onRangeChanged()
+{
+    // Only the range changed, for example because the chart is being panned,
+    // so any values that were already fetched can be reused.
+    m_keepFetchedValues = true;
+    onDataChanged();
+    m_keepFetchedValues = false;
+}
+
+const ComputedValues &XYChart::computedValues() const
+{
+    return m_computedValues;
+}
+
 void XYChart::setComputedRange(ComputedRange range)
 {
     if (range == m_computedRange) {
@@ -130,6 +260,136 @@ void XYChart::setComputedRange(ComputedRange range)
     Q_EMIT computedRangeChanged();
 }
 
+void XYChart::updateComputedValues(int startX, int count)
+{
+    const auto sources = valueSources();
+    const int sourceCount = sources.size();
+
+    count = std::max(count, 0);
+    m_computedValues.sourceCount = sourceCount;
+    m_computedValues.itemCount = count;
+    m_computedValues.values.resize(sourceCount * count);
+
+    const bool hasBaseline = m_stackingMode == StackingMode::Centered || m_stackingMode == StackingMode::Wiggle;
+    if (hasBaseline) {
+        m_computedValues.baseline.resize(count);
+    } else {
+        m_computedValues.baseline.clear();
+    }
+
+    m_computedValues.xValues.resize(m_xValueSource ? count : 0);
+    for (int item = 0; item < m_computedValues.xValues.size(); ++item) {
+        m_computedValues.xValues[item] = m_xValueSource->item(startX + item).toDouble();
+    }
+
+    if (count == 0 || sourceCount == 0) {
+        m_computedValues.minimum = 0.0;
+        m_computedValues.maximum = 0.0;
+        return;
+    }
+
+    auto minimum = std::numeric_limits<qreal>::max();
+    auto maximum = std::numeric_limits<qreal>::lowest();
+
+    // Fetch all values in a single pass over each item, so the total and
+    // baseline of that item are known before the values are accumulated.
+    // This way charts do not need to do any stacking themselves.
+    QList<qreal> column(sourceCount);
+    QList<qreal> previousColumn(sourceCount);
+    qreal wiggleBaseline = 0.0;
+
+    fetchValues(startX, count);
+    const qreal *fetched = m_fetchedValues.constData() + (startX - m_fetchedStart);
+
+    qreal *values = m_computedValues.values.data();
+    for (int item = 0; item < count; ++item) {
+        qreal total = 0.0;
+        for (int source = 0; source < sourceCount; ++source) {
+            column[source] = fetched[source * m_fetchedCount + item];
+            total += column[source];
+        }
+
+        qreal baseline = 0.0;
+        if (m_stackingMode == StackingMode::Centered) {
+            baseline = -total / 2.0;
+        } else if (m_stackingMode == StackingMode::Wiggle) {
+            // Minimize the weighted change in slope of all layers, see "Stacked
+            // Graphs - Geometry & Aesthetics" by Byron and Wattenberg.
+            if (item > 0) {
+                qreal change = 0.0;
+                for (int source = 0; source < sourceCount; ++source) {
+                    change += (sourceCount - source) * (column.at(source) - previousColumn.at(source));
+                }
+                wiggleBaseline -= change / (sourceCount + 1);
+            }
+            baseline = wiggleBaseline;
+        }
+
+        if (hasBaseline) {
+            m_computedValues.baseline[item] = baseline;
+            minimum = std::min(minimum, baseline);
+            maximum = std::max(maximum, baseline);
+        }
+
+        qreal accumulated = baseline;
+        for (int source = 0; source < sourceCount; ++source) {
+            auto value = column.at(source);
+            if (m_stackingMode == StackingMode::Percentage) {
+                value = !qFuzzyIsNull(total) ? value / total : 0.0;
+            }
+
+            if (m_stackingMode != StackingMode::NotStacked) {
+                accumulated += value;
+                value = accumulated;
+            }
+
+            values[source * count + item] = value;
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+        }
+
+        std::swap(column, previousColumn);
+    }
+
+    m_computedValues.minimum = minimum;
+    m_computedValues.maximum = maximum;
+}
+
+void XYChart::fetchValues(int startX, int count)
+{
+    const auto sources = valueSources();
+    const int sourceCount = sources.size();
+
+    const int start = std::max(0, startX - 1);
+    const int fetchCount = (startX - start) + count + 1;
+
+    // Values are only read from the sources when they were not fetched
+    // before, so moving the range only reads the newly visible items.
+    const bool reuse = m_fetchedValid && m_fetchedSourceCount == sourceCount;
+    const int reuseStart = reuse ? std::max(start, m_fetchedStart) : 0;
+    const int reuseEnd = reuse ? std::min(start + fetchCount, m_fetchedStart + m_fetchedCount) : 0;
+
+    QList<qreal> result(sourceCount * fetchCount);
+    for (int source = 0; source < sourceCount; ++source) {
+        auto valueSource = sources.at(source);
+        auto row = result.data() + source * fetchCount;
+        if (reuseStart < reuseEnd) {
+            auto previous = m_fetchedValues.constData() + source * m_fetchedCount;
+            valueSource->readValues(start, reuseStart - start, row);
+            std::copy(previous + (reuseStart - m_fetchedStart), previous + (reuseEnd - m_fetchedStart), row + (reuseStart - start));
+            valueSource->readValues(reuseEnd, start + fetchCount - reuseEnd, row + (reuseEnd - start));
+        } else {
+            valueSource->readValues(start, fetchCount, row);
+        }
+    }
+
+    m_fetchedValues = std::move(result);
+    m_fetchedStart = start;
+    m_fetchedCount = fetchCount;
+    m_fetchedSourceCount = sourceCount;
+    m_fetchedValid = true;
+}
+
 QDebug operator<<(QDebug debug, const ComputedRange &range)
 {
     debug << "Range: startX" << range.startX << "endX" << range.endX << "distance" << range.distanceX << "startY" << range.startY << "endY" << range.endY
@@ -19,6 +19,11 @@ struct ComputedRange {
     int startX = 0;
     int endX = 0;
     int distanceX = 0;
+    // The X range in X values. Without an X value source, these are the same
+    // as the item indices.
+    qreal startXValue = 0.0;
+    qreal endXValue = 0.0;
+    qreal distanceXValue = 0.0;
     float startY = 0.0;
     float endY = 0.0;
     float distanceY = 0.0;
@@ -26,6 +31,32 @@ struct ComputedRange {
 
 bool operator==(const ComputedRange &first, const ComputedRange &second);
 
+/**
+ * A helper containing the values of a chart's value sources within its computed range.
+ *
+ * Values are stored as a single matrix with one row per value source and one
+ * column per item in the computed X range, starting at ComputedRange::startX.
+ * When the chart is stacked, each entry contains the sum of that item and the
+ * same item of all previous value sources, starting from the baseline.
+ */
+struct ComputedValues {
+    int sourceCount = 0;
+    int itemCount = 0;
+    QList<qreal> values;
+    // The value stacking starts from for each item. Empty if stacking starts at 0.
+    QList<qreal> baseline;
+    // The minimum and maximum of values and baseline.
+    qreal minimum = 0.0;
+    qreal maximum = 0.0;
+    // The X value of each item. Empty if the chart has no X value source.
+    QList<qreal> xValues;
+
+    qreal value(int source, int item) const
+    {
+        return values.at(source * itemCount + item);
+    }
+};
+
 /*!
  * \qmltype XYChart
  * \inherits Chart
@@ -60,6 +91,34 @@ public:
     };
     Q_ENUM(Direction)
 
+    /*!
+     * \enum XYChart::StackingMode
+     *
+     * How the values of different value sources are combined.
+     *
+     * \value NotStacked
+     *        Values are not stacked, each value source is rendered independently.
+     * \value Stacked
+     *        Values are added on top of the values of the previous value sources.
+     * \value Percentage
+     *        Values are stacked and normalized so the total of all value sources
+     *        is 1 for each item. The Y range will be 0 to 1.
+     * \value Centered
+     *        Values are stacked on top of a baseline that keeps the total of all
+     *        value sources centered around 0, also known as a silhouette graph.
+     * \value Wiggle
+     *        Values are stacked on top of a baseline that minimizes the change in
+     *        slope of all value sources, also known as a streamgraph.
+     */
+    enum class StackingMode {
+        NotStacked,
+        Stacked,
+        Percentage,
+        Centered,
+        Wiggle
+    };
+    Q_ENUM(StackingMode)
+
     explicit XYChart(QQuickItem *parent = nullptr);
     ~XYChart() override = default;
 
@@ -87,6 +146,10 @@ public:
      *
      * increment: The amount with which the range increases. The total range will be limited to a multiple of this value. This is mostly useful when automatic
      * is true. The default is 0.0, which means do not limit the range increment.
+     *
+     * With automatic set to false, from and to can be changed to pan or zoom
+     * the chart. Only items within the range are read from the value sources
+     * and items that were already read are reused when the range moves.
      */
     Q_PROPERTY(RangeGroup *xRange READ xRange CONSTANT)
     virtual RangeGroup *xRange() const;
@@ -133,11 +196,42 @@ public:
      * When true, Y values will be added on top of each other. The precise
      * meaning of this property depends on the specific chart. The default is
      * false.
+     *
+     * This is true if stackingMode is anything other than XYChart.NotStacked.
+     * Setting it to true will set stackingMode to XYChart.Stacked.
      */
     Q_PROPERTY(bool stacked READ stacked WRITE setStacked NOTIFY stackedChanged)
     bool stacked() const;
     void setStacked(bool newStacked);
     Q_SIGNAL void stackedChanged();
+    /*!
+     * \qmlproperty enumeration XYChart::stackingMode
+     * \qmlenumeratorsfrom XYChart::StackingMode
+     * \brief How the values of each value source should be stacked.
+     *
+     * The default is XYChart.NotStacked.
+     */
+    Q_PROPERTY(StackingMode stackingMode READ stackingMode WRITE setStackingMode NOTIFY stackingModeChanged)
+    StackingMode stackingMode() const;
+    void setStackingMode(StackingMode newStackingMode);
+    Q_SIGNAL void stackingModeChanged();
+    /*!
+     * \qmlproperty ChartDataSource XYChart::xValueSource
+     * \brief A data source that provides the X value of each item.
+     *
+     * By default, items are evenly spaced along the X axis. When this is set,
+     * each item is instead placed at the X value provided by this source,
+     * which allows displaying data that was not sampled at regular intervals.
+     * xRange will then be in terms of these X values rather than item indices.
+     *
+     * \note X values are expected to be sorted in ascending order.
+     * \note BarChart only uses this to determine which items are within
+     *       xRange, bars are still spaced evenly.
+     */
+    Q_PROPERTY(ChartDataSource *xValueSource READ xValueSource WRITE setXValueSource NOTIFY xValueSourceChanged)
+    ChartDataSource *xValueSource() const;
+    void setXValueSource(ChartDataSource *newXValueSource);
+    Q_SIGNAL void xValueSourceChanged();
 
     /*
      * Get the complete, calculated range for this chart.
@@ -148,7 +242,23 @@ public:
      */
     Q_SIGNAL void computedRangeChanged();
 
+    /*
+     * Get the values of all value sources within the computed range.
+     *
+     * These are updated together with the computed range, so subclasses
+     * should use these instead of reading from the value sources directly.
+     */
+    const ComputedValues &computedValues() const;
+
 protected:
+    /**
+     * Called whenever the chart's data changes.
+     *
+     * Subclasses overriding this should call the base implementation, so
+     * values will be fetched again from the value sources.
+     */
+    void onDataChanged() override;
+
     /**
      * Re-calculate the chart's range.
      *
@@ -166,11 +276,26 @@ protected:
     void setComputedRange(ComputedRange range);
 
 private:
+    void onRangeChanged();
+    void updateComputedValues(int startX, int count);
+    void fetchValues(int startX, int count);
+
     RangeGroup *m_xRange = nullptr;
     RangeGroup *m_yRange = nullptr;
     Direction m_direction = Direction::ZeroAtStart;
-    bool m_stacked = false;
+    StackingMode m_stackingMode = StackingMode::NotStacked;
+    ChartDataSource *m_xValueSource = nullptr;
     ComputedRange m_computedRange;
+    ComputedValues m_computedValues;
+
+    // Raw values of the value sources, one row per source, covering the
+    // computed X range plus one item on either side.
+    QList<qreal> m_fetchedValues;
+    int m_fetchedStart = 0;
+    int m_fetchedCount = 0;
+    int m_fetchedSourceCount = 0;
+    bool m_fetchedValid = false;
+    bool m_keepFetchedValues = false;
 };
 
 QDebug operator<<(QDebug debug, const ComputedRange &range);
@@ -0,0 +1,247 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "AggregateProxySource.h"
+
+#include <algorithm>
+#include <numeric>
+
+// The amount of items to read from the source at once.
+static const int ChunkSize = 64 * 1024;
+
+static qreal aggregate(AggregateProxySource::Aggregation aggregation, const qreal *begin, const qreal *end)
+{
+    switch (aggregation) {
+    case AggregateProxySource::Minimum:
+        return *std::min_element(begin, end);
+    case AggregateProxySource::Maximum:
+        return *std::max_element(begin, end);
+    case AggregateProxySource::Average:
+        return std::accumulate(begin, end, 0.0) / (end - begin);
+    case AggregateProxySource::Sum:
+        return std::accumulate(begin, end, 0.0);
+    case AggregateProxySource::Last:
+        return *(end - 1);
+    case AggregateProxySource::Count:
+        return end - begin;
+    }
+
+    return 0.0;
+}
+
+AggregateProxySource::AggregateProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &AggregateProxySource::aggregationChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &AggregateProxySource::bucketSizeChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &AggregateProxySource::bucketCountChanged, this, &ChartDataSource::dataChanged);
+}
+
+ChartDataSource *AggregateProxySource::source() const
+{
+    return m_source;
+}
+
+void AggregateProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::itemsAppended, this, [this](int first) {
+            m_appendedFirst = first;
+        });
+        connect(m_source, &ChartDataSource::dataChanged, this, [this]() {
+            const auto previousCount = m_values.size();
+            const auto previousBucketSize = m_currentBucketSize;
+            const auto appended = m_appendedFirst >= 0 && m_appendedFirst == m_sourceItemCount;
+            const auto lastBucketComplete = m_sourceItemCount % m_currentBucketSize == 0;
+
+            // When items were only appended to the items we already processed,
+            // only the last bucket and any new buckets need to be updated.
+            update(appended ? m_appendedFirst : 0);
+            m_appendedFirst = -1;
+
+            // If the last bucket was complete and the bucket size is the
+            // same, none of the existing items changed, so we can pass on
+            // that we only added items.
+            if (appended && lastBucketComplete && m_currentBucketSize == previousBucketSize && m_values.size() > previousCount) {
+                Q_EMIT itemsAppended(previousCount, m_values.size() - previousCount);
+            }
+            Q_EMIT dataChanged();
+        });
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update(0);
+            Q_EMIT dataChanged();
+        });
+    }
+
+    update(0);
+    Q_EMIT sourceChanged();
+    Q_EMIT dataChanged();
+}
+
+AggregateProxySource::Aggregation AggregateProxySource::aggregation() const
+{
+    return m_aggregation;
+}
+
+void AggregateProxySource::setAggregation(Aggregation newAggregation)
+{
+    if (newAggregation == m_aggregation) {
+        return;
+    }
+
+    m_aggregation = newAggregation;
+    update(0);
+    Q_EMIT aggregationChanged();
+}
+
+int AggregateProxySource::bucketSize() const
+{
+    return m_bucketSize;
+}
+
+void AggregateProxySource::setBucketSize(int newBucketSize)
+{
+    newBucketSize = std::max(newBucketSize, 1);
+    if (newBucketSize == m_bucketSize) {
+        return;
+    }
+
+    m_bucketSize = newBucketSize;
+    update(0);
+    Q_EMIT bucketSizeChanged();
+}
+
+int AggregateProxySource::bucketCount() const
+{
+    return m_bucketCount;
+}
+
+void AggregateProxySource::setBucketCount(int newBucketCount)
+{
+    newBucketCount = std::max(newBucketCount, 0);
+    if (newBucketCount == m_bucketCount) {
+        return;
+    }
+
+    m_bucketCount = newBucketCount;
+    update(0);
+    Q_EMIT bucketCountChanged();
+}
+
+int AggregateProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant AggregateProxySource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant AggregateProxySource::minimum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    return m_minimum;
+}
+
+QVariant AggregateProxySource::maximum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    return m_maximum;
+}
+
+void AggregateProxySource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < m_values.size() ? m_values.at(index) : 0.0;
+    }
+}
+
+void AggregateProxySource::update(int first)
+{
+    m_sourceItemCount = m_source ? m_source->itemCount() : 0;
+
+    // All buckets change when the bucket size changes.
+    const auto bucketSize = effectiveBucketSize(m_sourceItemCount);
+    if (bucketSize != m_currentBucketSize) {
+        m_currentBucketSize = bucketSize;
+        first = 0;
+    }
+
+    const auto previousCount = int(m_values.size());
+    const auto bucketCount = (m_sourceItemCount + bucketSize - 1) / bucketSize;
+    const auto firstBucket = std::min(first / bucketSize, bucketCount);
+
+    // Minimum and maximum only need to be recalculated from all buckets if a
+    // bucket containing one of them is rewritten, otherwise the new buckets
+    // can be included in the existing minimum and maximum.
+    auto rescan = firstBucket == 0 || bucketCount < previousCount;
+    for (int bucket = firstBucket; bucket < previousCount && !rescan; ++bucket) {
+        rescan = m_values.at(bucket) == m_minimum || m_values.at(bucket) == m_maximum;
+    }
+
+    m_values.resize(bucketCount);
+
+    // Read the source in chunks of whole buckets, so we do not need a buffer
+    // the size of the entire source.
+    const auto bucketsPerChunk = std::max(ChunkSize / bucketSize, 1);
+    QList<qreal> buffer;
+    for (int bucket = firstBucket; bucket < bucketCount; bucket += bucketsPerChunk) {
+        const auto start = bucket * bucketSize;
+        const auto count = std::min(bucketsPerChunk * bucketSize, m_sourceItemCount - start);
+
+        buffer.resize(count);
+        m_source->readValues(start, count, buffer.data());
+
+        for (int offset = 0; offset < count; offset += bucketSize) {
+            const auto begin = buffer.constData() + offset;
+            const auto end = begin + std::min(bucketSize, count - offset);
+            m_values[bucket + offset / bucketSize] = aggregate(m_aggregation, begin, end);
+        }
+    }
+
+    if (rescan && !m_values.isEmpty()) {
+        const auto [minimum, maximum] = std::minmax_element(m_values.cbegin(), m_values.cend());
+        m_minimum = *minimum;
+        m_maximum = *maximum;
+    } else if (firstBucket < bucketCount) {
+        const auto [minimum, maximum] = std::minmax_element(m_values.cbegin() + firstBucket, m_values.cend());
+        m_minimum = std::min(m_minimum, *minimum);
+        m_maximum = std::max(m_maximum, *maximum);
+    }
+}
+
+int AggregateProxySource::effectiveBucketSize(int sourceItemCount) const
+{
+    if (m_bucketCount > 0) {
+        return std::max((sourceItemCount + m_bucketCount - 1) / m_bucketCount, 1);
+    }
+    return m_bucketSize;
+}
+
+#include "moc_AggregateProxySource.cpp"
@@ -0,0 +1,141 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <QList>
+#include <QVariant>
+
+/*!
+ * \qmltype AggregateProxySource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A source that combines consecutive items of a different source.
+ *
+ * This source divides the items of another source into buckets of
+ * \l bucketSize items and provides a single item for each bucket, combining
+ * the items of the bucket as specified by \l aggregation. For example, with
+ * a source providing a value per second, a bucket size of 60 and the Average
+ * aggregation this will provide the average value per minute.
+ *
+ * Alternatively, set \l bucketCount to divide the source into a fixed number
+ * of buckets, with the bucket size following the number of items of the
+ * source.
+ *
+ * The last bucket may contain fewer items than the others. If the source
+ * emits itemsAppended, only the buckets containing new items are updated,
+ * unless the bucket size changes as a result.
+ *
+ * \sa DownsampleProxySource
+ */
+class QUICKCHARTS_EXPORT AggregateProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /*!
+     * \enum AggregateProxySource::Aggregation
+     *
+     * How the items of a bucket are combined.
+     *
+     * \value Minimum
+     *        Use the smallest value in a bucket.
+     * \value Maximum
+     *        Use the largest value in a bucket.
+     * \value Average
+     *        Use the average of all values in a bucket.
+     * \value Sum
+     *        Use the sum of all values in a bucket.
+     * \value Last
+     *        Use the last value in a bucket.
+     * \value Count
+     *        Use the number of items in a bucket.
+     */
+    // The first values match DownsampleProxySource::Aggregation.
+    enum Aggregation {
+        Minimum,
+        Maximum,
+        Average,
+        Sum,
+        Last,
+        Count,
+    };
+    Q_ENUM(Aggregation)
+
+    explicit AggregateProxySource(QObject *parent = nullptr);
+
+    /*!
+     * \qmlproperty ChartDataSource AggregateProxySource::source
+     * \brief The source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+    /*!
+     * \qmlproperty enumeration AggregateProxySource::aggregation
+     * \qmlenumeratorsfrom AggregateProxySource::Aggregation
+     * \brief How the items of a bucket are combined.
+     *
+     * The default is AggregateProxySource.Average.
+     */
+    Q_PROPERTY(Aggregation aggregation READ aggregation WRITE setAggregation NOTIFY aggregationChanged)
+    Aggregation aggregation() const;
+    void setAggregation(Aggregation newAggregation);
+    Q_SIGNAL void aggregationChanged();
+    /*!
+     * \qmlproperty int AggregateProxySource::bucketSize
+     * \brief The number of items of the source that are combined into a single item.
+     *
+     * This is ignored if bucketCount is set. The default is 10.
+     */
+    Q_PROPERTY(int bucketSize READ bucketSize WRITE setBucketSize NOTIFY bucketSizeChanged)
+    int bucketSize() const;
+    void setBucketSize(int newBucketSize);
+    Q_SIGNAL void bucketSizeChanged();
+    /*!
+     * \qmlproperty int AggregateProxySource::bucketCount
+     * \brief The number of items to provide.
+     *
+     * If set to a value > 0, the items of the source are divided into at most
+     * this number of buckets, using the smallest bucket size for which they
+     * fit. \l bucketSize is then ignored.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int bucketCount READ bucketCount WRITE setBucketCount NOTIFY bucketCountChanged)
+    int bucketCount() const;
+    void setBucketCount(int newBucketCount);
+    Q_SIGNAL void bucketCountChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void update(int first);
+    int effectiveBucketSize(int sourceItemCount) const;
+
+    ChartDataSource *m_source = nullptr;
+    Aggregation m_aggregation = Average;
+    int m_bucketSize = 10;
+    int m_bucketCount = 0;
+
+    QList<qreal> m_values;
+    // The bucket size used for the current values.
+    int m_currentBucketSize = 10;
+    int m_sourceItemCount = 0;
+    int m_appendedFirst = -1;
+    qreal m_minimum = 0.0;
+    qreal m_maximum = 0.0;
+};
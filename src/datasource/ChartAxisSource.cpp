@@ -15,19 +15,44 @@
 ChartAxisSource::ChartAxisSource(QObject *parent)
     : ChartDataSource(parent)
 {
-    connect(this, &ChartAxisSource::itemCountChanged, this, &ChartAxisSource::dataChanged);
+    // Connected first, so the ticks are invalidated before anything else
+    // reacts to the change.
+    connect(this, &ChartAxisSource::dataChanged, this, [this]() {
+        m_ticksValid = false;
+
+        // Outside of EvenTicks, the number of ticks depends on the range, so
+        // it can change with any change of the data.
+        const auto count = itemCount();
+        if (count != m_reportedItemCount) {
+            m_reportedItemCount = count;
+            Q_EMIT itemCountChanged();
+        }
+    });
     connect(this, &ChartAxisSource::chartChanged, this, &ChartAxisSource::dataChanged);
     connect(this, &ChartAxisSource::axisChanged, this, &ChartAxisSource::dataChanged);
+    connect(this, &ChartAxisSource::tickModeChanged, this, &ChartAxisSource::dataChanged);
 }
 
 QVariant ChartAxisSource::item(int index) const
 {
-    if (!m_chart || index < 0 || index > m_itemCount) {
+    if (!m_chart || index < 0) {
+        return {};
+    }
+
+    if (m_tickMode != TickMode::EvenTicks) {
+        const auto &major = ticks().major;
+        return index < major.size() ? QVariant{major.at(index)} : QVariant{};
+    }
+
+    if (index > m_itemCount) {
         return {};
     }
 
     auto range = m_chart->computedRange();
     if (m_axis == Axis::XAxis) {
+        if (m_chart->xValueSource()) {
+            return range.startXValue + (range.distanceXValue / (m_itemCount - 1)) * index;
+        }
         return range.startX + (range.distanceX / (m_itemCount - 1)) * index;
     } else {
         return range.startY + (range.distanceY / (m_itemCount - 1)) * index;
@@ -41,6 +66,9 @@ QVariant ChartAxisSource::minimum() const
     }
 
     if (m_axis == Axis::XAxis) {
+        if (m_chart->xValueSource()) {
+            return m_chart->computedRange().startXValue;
+        }
         return m_chart->computedRange().startX;
     } else {
         return m_chart->computedRange().startY;
@@ -54,6 +82,9 @@ QVariant ChartAxisSource::maximum() const
     }
 
     if (m_axis == Axis::XAxis) {
+        if (m_chart->xValueSource()) {
+            return m_chart->computedRange().endXValue;
+        }
         return m_chart->computedRange().endX;
     } else {
         return m_chart->computedRange().endY;
@@ -99,6 +130,10 @@ void ChartAxisSource::setAxis(ChartAxisSource::Axis newAxis)
 
 int ChartAxisSource::itemCount() const
 {
+    if (m_tickMode != TickMode::EvenTicks) {
+        return ticks().major.size();
+    }
+
     return m_itemCount;
 }
 
@@ -109,7 +144,49 @@ void ChartAxisSource::setItemCount(int newItemCount)
     }
 
     m_itemCount = newItemCount;
-    Q_EMIT itemCountChanged();
+    // itemCountChanged is emitted when the resulting number of ticks changes.
+    Q_EMIT dataChanged();
+}
+
+ChartAxisSource::TickMode ChartAxisSource::tickMode() const
+{
+    return m_tickMode;
+}
+
+void ChartAxisSource::setTickMode(ChartAxisSource::TickMode newTickMode)
+{
+    if (newTickMode == m_tickMode) {
+        return;
+    }
+
+    m_tickMode = newTickMode;
+    Q_EMIT tickModeChanged();
+}
+
+const AxisTicks &ChartAxisSource::ticks() const
+{
+    if (m_ticksValid) {
+        return m_ticks;
+    }
+
+    m_ticks = AxisTicks{};
+    m_ticksValid = true;
+
+    if (!m_chart) {
+        return m_ticks;
+    }
+
+    if (m_tickMode == TickMode::EvenTicks) {
+        m_ticks.major.reserve(m_itemCount);
+        for (int i = 0; i < m_itemCount; ++i) {
+            m_ticks.major.append(item(i).toDouble());
+        }
+        return m_ticks;
+    }
+
+    const auto unit = m_tickMode == TickMode::TimeTicks ? AxisTicks::Unit::Time : AxisTicks::Unit::Number;
+    m_ticks = AxisTicks::calculate(minimum().toDouble(), maximum().toDouble(), m_itemCount, unit);
+    return m_ticks;
 }
 
 #include "moc_ChartAxisSource.cpp"
@@ -8,6 +8,7 @@
 #ifndef CHARTAXISSOURCE_H
 #define CHARTAXISSOURCE_H
 
+#include "AxisTicks.h"
 #include "ChartDataSource.h"
 
 class XYChart;
@@ -18,6 +19,10 @@ class XYChart;
  * \inqmlmodule org.kde.quickcharts
  *
  * \brief A data source that provides values from a chart's axis as data.
+ *
+ * The values are the positions of ticks on the axis, which can be used for
+ * things like axis labels and grid lines. How the ticks are placed is
+ * determined by tickMode.
  */
 class QUICKCHARTS_EXPORT ChartAxisSource : public ChartDataSource
 {
@@ -28,6 +33,21 @@ public:
     enum class Axis { XAxis, YAxis };
     Q_ENUM(Axis)
 
+    /*!
+     * \value EvenTicks
+     *        Place itemCount ticks evenly between the start and end of the
+     *        axis.
+     * \value NiceTicks
+     *        Place ticks at multiples of one, two or five times a power of
+     *        ten, using at most itemCount ticks.
+     * \value TimeTicks
+     *        Treat values as times in milliseconds and place ticks at
+     *        multiples of common units of time, like 15 minutes or 6 hours,
+     *        using at most itemCount ticks.
+     */
+    enum class TickMode { EvenTicks, NiceTicks, TimeTicks };
+    Q_ENUM(TickMode)
+
     ChartAxisSource(QObject *parent = nullptr);
 
     /*!
@@ -46,12 +66,37 @@ public:
     Q_SIGNAL void axisChanged();
     /*!
      * \qmlproperty int ChartAxisSource::itemCount
+     * \brief The number of ticks.
+     *
+     * When tickMode is not ChartAxisSource.EvenTicks, this is the maximum
+     * number of ticks and reading it returns the number of ticks that were
+     * actually placed.
      */
     Q_PROPERTY(int itemCount READ itemCount WRITE setItemCount NOTIFY itemCountChanged)
     int itemCount() const override;
     Q_SLOT void setItemCount(int newItemCount);
     Q_SIGNAL void itemCountChanged();
 
+    /*!
+     * \qmlproperty enumeration ChartAxisSource::tickMode
+     * \qmlenumeratorsfrom ChartAxisSource::TickMode
+     * \brief How to place ticks on the axis.
+     *
+     * The default is ChartAxisSource.EvenTicks.
+     */
+    Q_PROPERTY(ChartAxisSource::TickMode tickMode READ tickMode WRITE setTickMode NOTIFY tickModeChanged)
+    ChartAxisSource::TickMode tickMode() const;
+    Q_SLOT void setTickMode(ChartAxisSource::TickMode newTickMode);
+    Q_SIGNAL void tickModeChanged();
+
+    /**
+     * The ticks for the current range of the axis.
+     *
+     * These are calculated once whenever the data of this source changes, so
+     * things that are placed along the axis can share them.
+     */
+    const AxisTicks &ticks() const;
+
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
@@ -60,6 +105,14 @@ private:
     XYChart *m_chart = nullptr;
     Axis m_axis = Axis::XAxis;
     int m_itemCount = 2;
+    TickMode m_tickMode = TickMode::EvenTicks;
+
+    // The item count at the last change, to know when itemCountChanged needs
+    // to be emitted.
+    int m_reportedItemCount = 2;
+
+    mutable AxisTicks m_ticks;
+    mutable bool m_ticksValid = false;
 };
 
 #endif // CHARTAXISSOURCE_H
@@ -20,6 +20,20 @@ QVariant ChartDataSource::first() const
     return item(0);
 }
 
+void ChartDataSource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        output[i] = item(start + i).toDouble();
+    }
+}
+
+void ChartDataSource::readColors(int start, int count, QColor *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        output[i] = item(start + i).value<QColor>();
+    }
+}
+
 bool ChartDataSource::variantCompare(const QVariant &lhs, const QVariant &rhs)
 {
     return QVariant::compare(lhs, rhs) == QPartialOrdering::Less;
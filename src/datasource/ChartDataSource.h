@@ -13,6 +13,8 @@
 
 #include "quickcharts_export.h"
 
+class QColor;
+
 /*!
  * \qmltype ChartDataSource
  * \inqmlmodule org.kde.quickcharts
@@ -39,7 +41,33 @@ public:
 
     virtual QVariant first() const;
 
+    /**
+     * Read count items, starting at start, as numbers into output.
+     *
+     * Items outside of the source are read as 0. The default implementation
+     * calls item() for each item, sources that can provide numbers directly
+     * should override this.
+     */
+    virtual void readValues(int start, int count, qreal *output) const;
+    /**
+     * Read count items starting at start as colors into output.
+     *
+     * Items that are out of range or are not colors are read as an invalid
+     * color. The default implementation converts the result of item() for
+     * each item, sources that can provide colors directly should override
+     * this.
+     */
+    virtual void readColors(int start, int count, QColor *output) const;
+
     Q_SIGNAL void dataChanged();
+    /**
+     * Emitted right before dataChanged when the only change is that count
+     * items were added at the end, starting at first.
+     *
+     * Sources that can detect this should emit it, so that consumers can
+     * update incrementally rather than reading all items again.
+     */
+    Q_SIGNAL void itemsAppended(int first, int count);
 
 protected:
     static bool variantCompare(const QVariant &lhs, const QVariant &rhs);
@@ -9,10 +9,57 @@
 
 #include "ColorGradientSource.h"
 
+#include <QCache>
 #include <QVariant>
 
 #include <QDebug>
 
+// The number of generated palettes to keep around.
+static const int PaletteCacheSize = 64;
+
+struct PaletteKey {
+    qreal hue;
+    qreal saturation;
+    qreal value;
+    qreal alpha;
+    int itemCount;
+
+    bool operator==(const PaletteKey &other) const
+    {
+        return hue == other.hue && saturation == other.saturation && value == other.value && alpha == other.alpha && itemCount == other.itemCount;
+    }
+};
+
+static size_t qHash(const PaletteKey &key, size_t seed = 0)
+{
+    return qHashMulti(seed, key.hue, key.saturation, key.value, key.alpha, key.itemCount);
+}
+
+static QList<QColor> generateColors(const QColor &baseColor, int itemCount)
+{
+    // Many charts use the same colors, so share the generated colors rather
+    // than generating them for every source. QList is implicitly shared, so
+    // sources using a cached palette do not copy the colors.
+    static QCache<PaletteKey, QList<QColor>> cache(PaletteCacheSize);
+
+    const auto key = PaletteKey{baseColor.hsvHueF(), baseColor.hsvSaturationF(), baseColor.valueF(), baseColor.alphaF(), itemCount};
+    if (auto colors = cache.object(key)) {
+        return *colors;
+    }
+
+    auto colors = new QList<QColor>;
+    colors->reserve(itemCount);
+    for (int i = 0; i < itemCount; ++i) {
+        auto newHue = key.hue + i * (1.0 / itemCount);
+        newHue = newHue - int(newHue);
+        colors->append(QColor::fromHsvF(newHue, key.saturation, key.value, key.alpha));
+    }
+
+    auto result = *colors;
+    cache.insert(key, colors);
+    return result;
+}
+
 ColorGradientSource::ColorGradientSource(QObject *parent)
     : ChartDataSource(parent)
 {
@@ -42,6 +89,14 @@ QVariant ColorGradientSource::maximum() const
     return QVariant{};
 }
 
+void ColorGradientSource::readColors(int start, int count, QColor *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < m_colors.size() ? m_colors.at(index) : QColor{};
+    }
+}
+
 QColor ColorGradientSource::baseColor() const
 {
     return m_baseColor;
@@ -85,13 +140,7 @@ void ColorGradientSource::regenerateColors()
         return;
     }
 
-    m_colors.clear();
-
-    for (int i = 0; i < m_itemCount; ++i) {
-        auto newHue = m_baseColor.hsvHueF() + i * (1.0 / m_itemCount);
-        newHue = newHue - int(newHue);
-        m_colors.append(QColor::fromHsvF(newHue, m_baseColor.saturationF(), m_baseColor.valueF(), m_baseColor.alphaF()));
-    }
+    m_colors = generateColors(m_baseColor, m_itemCount);
 
     Q_EMIT dataChanged();
 }
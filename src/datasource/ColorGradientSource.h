@@ -21,6 +21,9 @@
  * \inqmlmodule org.kde.quickcharts
  *
  * \brief A data source that provides a hue-shifted color as data.
+ *
+ * The generated colors are shared between all sources with the same base
+ * color and item count.
  */
 class QUICKCHARTS_EXPORT ColorGradientSource : public ChartDataSource
 {
@@ -55,6 +58,7 @@ public:
     QVariant item(int index) const override;
     QVariant minimum() const override;
     QVariant maximum() const override;
+    void readColors(int start, int count, QColor *output) const override;
 
 private:
     void regenerateColors();
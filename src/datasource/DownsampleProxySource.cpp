@@ -0,0 +1,310 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "DownsampleProxySource.h"
+
+#include <algorithm>
+
+// Buckets smaller than 2^BaseLevel items are read directly from the source
+// rather than precalculated, which avoids storing roughly as many buckets as
+// there are items in the source.
+static const int BaseLevel = 3;
+
+DownsampleProxySource::DownsampleProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &DownsampleProxySource::aggregationChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &DownsampleProxySource::fromChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &DownsampleProxySource::toChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &DownsampleProxySource::maximumItemCountChanged, this, &ChartDataSource::dataChanged);
+}
+
+ChartDataSource *DownsampleProxySource::source() const
+{
+    return m_source;
+}
+
+void DownsampleProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::itemsAppended, this, [this](int first) {
+            m_appendedFirst = first;
+        });
+        connect(m_source, &ChartDataSource::dataChanged, this, [this]() {
+            // When items were only appended to the items we already processed,
+            // only the buckets containing new items need to be updated.
+            update(m_appendedFirst == m_sourceItemCount ? m_appendedFirst : 0);
+            m_appendedFirst = -1;
+            Q_EMIT dataChanged();
+        });
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update(0);
+            Q_EMIT dataChanged();
+        });
+    }
+
+    update(0);
+    Q_EMIT sourceChanged();
+    Q_EMIT dataChanged();
+}
+
+DownsampleProxySource::Aggregation DownsampleProxySource::aggregation() const
+{
+    return m_aggregation;
+}
+
+void DownsampleProxySource::setAggregation(Aggregation newAggregation)
+{
+    if (newAggregation == m_aggregation) {
+        return;
+    }
+
+    m_aggregation = newAggregation;
+    Q_EMIT aggregationChanged();
+}
+
+int DownsampleProxySource::from() const
+{
+    return m_from;
+}
+
+void DownsampleProxySource::setFrom(int newFrom)
+{
+    if (newFrom == m_from) {
+        return;
+    }
+
+    m_from = newFrom;
+    updateLevel();
+    Q_EMIT fromChanged();
+}
+
+int DownsampleProxySource::to() const
+{
+    return m_to;
+}
+
+void DownsampleProxySource::setTo(int newTo)
+{
+    if (newTo == m_to) {
+        return;
+    }
+
+    m_to = newTo;
+    updateLevel();
+    Q_EMIT toChanged();
+}
+
+int DownsampleProxySource::maximumItemCount() const
+{
+    return m_maximumItemCount;
+}
+
+void DownsampleProxySource::setMaximumItemCount(int newMaximumItemCount)
+{
+    if (newMaximumItemCount == m_maximumItemCount) {
+        return;
+    }
+
+    m_maximumItemCount = newMaximumItemCount;
+    updateLevel();
+    Q_EMIT maximumItemCountChanged();
+}
+
+int DownsampleProxySource::bucketSize() const
+{
+    return 1 << m_level;
+}
+
+int DownsampleProxySource::itemCount() const
+{
+    if (!m_source) {
+        return 0;
+    }
+
+    return bucketCount(m_level);
+}
+
+QVariant DownsampleProxySource::item(int index) const
+{
+    if (!m_source || index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    if (m_level == 0) {
+        return m_source->item(rangeStart() + index);
+    }
+
+    return value(index);
+}
+
+QVariant DownsampleProxySource::minimum() const
+{
+    const auto count = itemCount();
+    if (count == 0) {
+        return QVariant{};
+    }
+
+    auto result = std::numeric_limits<qreal>::max();
+    for (int i = 0; i < count; ++i) {
+        result = std::min(result, value(i));
+    }
+    return result;
+}
+
+QVariant DownsampleProxySource::maximum() const
+{
+    const auto count = itemCount();
+    if (count == 0) {
+        return QVariant{};
+    }
+
+    auto result = std::numeric_limits<qreal>::lowest();
+    for (int i = 0; i < count; ++i) {
+        result = std::max(result, value(i));
+    }
+    return result;
+}
+
+void DownsampleProxySource::update(int first)
+{
+    m_sourceItemCount = m_source ? m_source->itemCount() : 0;
+
+    auto size = (m_sourceItemCount + (1 << BaseLevel) - 1) >> BaseLevel;
+    first = std::clamp(first, 0, m_sourceItemCount) >> BaseLevel;
+
+    // Each level contains half as many buckets as the level below it, with
+    // each bucket combining two buckets of the level below.
+    int levelIndex = 0;
+    while (size > 0) {
+        if (levelIndex >= m_levels.size()) {
+            m_levels.append(QList<Bucket>{});
+        }
+
+        auto &buckets = m_levels[levelIndex];
+        buckets.resize(size);
+
+        for (int index = first; index < size; ++index) {
+            if (levelIndex == 0) {
+                buckets[index] = readBucket(BaseLevel, index);
+                continue;
+            }
+
+            const auto &previous = m_levels.at(levelIndex - 1);
+            auto bucket = previous.at(index * 2);
+            if (index * 2 + 1 < previous.size()) {
+                const auto &second = previous.at(index * 2 + 1);
+                bucket.minimum = std::min(bucket.minimum, second.minimum);
+                bucket.maximum = std::max(bucket.maximum, second.maximum);
+                bucket.sum += second.sum;
+            }
+            buckets[index] = bucket;
+        }
+
+        levelIndex++;
+        if (size == 1) {
+            break;
+        }
+
+        size = (size + 1) / 2;
+        first /= 2;
+    }
+
+    m_levels.resize(levelIndex);
+
+    updateLevel();
+}
+
+void DownsampleProxySource::updateLevel()
+{
+    const auto maximumLevel = m_levels.isEmpty() ? 0 : BaseLevel + int(m_levels.size()) - 1;
+
+    auto level = 0;
+    if (m_maximumItemCount > 0) {
+        while (level < maximumLevel && bucketCount(level) > m_maximumItemCount) {
+            level++;
+        }
+    }
+
+    m_level = level;
+}
+
+int DownsampleProxySource::rangeStart() const
+{
+    return std::clamp(m_from, 0, m_sourceItemCount);
+}
+
+int DownsampleProxySource::rangeEnd() const
+{
+    if (m_to < 0) {
+        return m_sourceItemCount;
+    }
+    return std::clamp(m_to, rangeStart(), m_sourceItemCount);
+}
+
+int DownsampleProxySource::bucketCount(int level) const
+{
+    const auto size = 1 << level;
+    return ((rangeEnd() + size - 1) >> level) - (rangeStart() >> level);
+}
+
+DownsampleProxySource::Bucket DownsampleProxySource::bucket(int level, int index) const
+{
+    if (level < BaseLevel) {
+        return readBucket(level, index);
+    }
+
+    return m_levels.at(level - BaseLevel).at(index);
+}
+
+DownsampleProxySource::Bucket DownsampleProxySource::readBucket(int level, int index) const
+{
+    Bucket result;
+
+    const auto start = index << level;
+    const auto end = std::min(start + (1 << level), m_sourceItemCount);
+    for (int i = start; i < end; ++i) {
+        const auto value = m_source->item(i).toDouble();
+        result.minimum = std::min(result.minimum, value);
+        result.maximum = std::max(result.maximum, value);
+        result.sum += value;
+    }
+
+    return result;
+}
+
+qreal DownsampleProxySource::value(int index) const
+{
+    const auto bucketIndex = (rangeStart() >> m_level) + index;
+    const auto result = bucket(m_level, bucketIndex);
+
+    switch (m_aggregation) {
+    case Minimum:
+        return result.minimum;
+    case Maximum:
+        return result.maximum;
+    case Average: {
+        const auto start = bucketIndex << m_level;
+        const auto count = std::min(1 << m_level, m_sourceItemCount - start);
+        return count > 0 ? result.sum / count : 0.0;
+    }
+    }
+
+    return 0.0;
+}
+
+#include "moc_DownsampleProxySource.cpp"
@@ -0,0 +1,155 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <limits>
+
+#include <QList>
+#include <QVariant>
+
+/*!
+ * \qmltype DownsampleProxySource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A source that provides a reduced number of items of a different source.
+ *
+ * This source divides the items of another source into buckets and provides
+ * the minimum, maximum or average of each bucket, choosing the bucket size
+ * such that the number of items within \l from and \l to does not exceed
+ * \l maximumItemCount. This is intended to display very large sources, by
+ * binding maximumItemCount to the width of a chart.
+ *
+ * Bucket sizes are a power of two. Aggregates for larger buckets are
+ * precalculated when the source changes, so accessing items is cheap at any
+ * bucket size. If the source emits itemsAppended, only the new items are
+ * processed.
+ *
+ * \note Buckets are aligned to multiples of the bucket size, so the first and
+ * last bucket may include items outside of from and to.
+ */
+class QUICKCHARTS_EXPORT DownsampleProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /*!
+     * \enum DownsampleProxySource::Aggregation
+     *
+     * How the items of a bucket are combined.
+     *
+     * \value Minimum
+     *        Use the smallest value in a bucket.
+     * \value Maximum
+     *        Use the largest value in a bucket.
+     * \value Average
+     *        Use the average of all values in a bucket.
+     */
+    enum Aggregation {
+        Minimum,
+        Maximum,
+        Average,
+    };
+    Q_ENUM(Aggregation)
+
+    explicit DownsampleProxySource(QObject *parent = nullptr);
+
+    /*!
+     * \qmlproperty ChartDataSource DownsampleProxySource::source
+     * \brief The source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+    /*!
+     * \qmlproperty enumeration DownsampleProxySource::aggregation
+     * \qmlenumeratorsfrom DownsampleProxySource::Aggregation
+     * \brief How the items of a bucket are combined.
+     *
+     * The default is DownsampleProxySource.Average.
+     */
+    Q_PROPERTY(Aggregation aggregation READ aggregation WRITE setAggregation NOTIFY aggregationChanged)
+    Aggregation aggregation() const;
+    void setAggregation(Aggregation newAggregation);
+    Q_SIGNAL void aggregationChanged();
+    /*!
+     * \qmlproperty int DownsampleProxySource::from
+     * \brief The first item of the source to provide.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int from READ from WRITE setFrom NOTIFY fromChanged)
+    int from() const;
+    void setFrom(int newFrom);
+    Q_SIGNAL void fromChanged();
+    /*!
+     * \qmlproperty int DownsampleProxySource::to
+     * \brief The item of the source after the last item to provide.
+     *
+     * If this is less than 0, all items until the end of the source are
+     * provided. The default is -1.
+     */
+    Q_PROPERTY(int to READ to WRITE setTo NOTIFY toChanged)
+    int to() const;
+    void setTo(int newTo);
+    Q_SIGNAL void toChanged();
+    /*!
+     * \qmlproperty int DownsampleProxySource::maximumItemCount
+     * \brief The maximum number of items this source should provide.
+     *
+     * If this is less than or equal to 0, items are not combined. The default
+     * is 1000.
+     */
+    Q_PROPERTY(int maximumItemCount READ maximumItemCount WRITE setMaximumItemCount NOTIFY maximumItemCountChanged)
+    int maximumItemCount() const;
+    void setMaximumItemCount(int newMaximumItemCount);
+    Q_SIGNAL void maximumItemCountChanged();
+    /*!
+     * \qmlproperty int DownsampleProxySource::bucketSize
+     * \brief The number of items of the source that are combined into a single item.
+     */
+    Q_PROPERTY(int bucketSize READ bucketSize NOTIFY dataChanged)
+    int bucketSize() const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+
+private:
+    struct Bucket {
+        qreal minimum = std::numeric_limits<qreal>::max();
+        qreal maximum = std::numeric_limits<qreal>::lowest();
+        qreal sum = 0.0;
+    };
+
+    void update(int first);
+    void updateLevel();
+    int rangeStart() const;
+    int rangeEnd() const;
+    int bucketCount(int level) const;
+    Bucket bucket(int level, int index) const;
+    Bucket readBucket(int level, int index) const;
+    qreal value(int index) const;
+
+    ChartDataSource *m_source = nullptr;
+    Aggregation m_aggregation = Average;
+    int m_from = 0;
+    int m_to = -1;
+    int m_maximumItemCount = 1000;
+
+    // Precalculated buckets, starting at a bucket size of 2^BaseLevel.
+    QList<QList<Bucket>> m_levels;
+    int m_sourceItemCount = 0;
+    int m_appendedFirst = -1;
+    int m_level = 0;
+};
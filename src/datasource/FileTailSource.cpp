@@ -0,0 +1,511 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "FileTailSource.h"
+
+#include <algorithm>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTimer>
+
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+// The amount of bytes to read from the file at once.
+static const qint64 ChunkSize = 1024 * 1024;
+// The amount of chunks to read before handling other events, so large files
+// do not block restarting or stopping the worker until they are fully read.
+static const int MaximumChunksPerRead = 16;
+// The amount of values to parse before sending them to the source.
+static const int BatchSize = 64 * 1024;
+// The maximum length of a line, longer lines are skipped.
+static const qsizetype MaximumLineLength = 1024 * 1024;
+
+// Identifies the file itself rather than its name, so a file that was
+// replaced by a different file can be detected.
+static QByteArray fileIdentity(QFile &file)
+{
+#ifdef Q_OS_UNIX
+    struct stat status;
+    if (fstat(file.handle(), &status) == 0) {
+        return QByteArray::number(quint64(status.st_dev)) + ':' + QByteArray::number(quint64(status.st_ino));
+    }
+#endif
+    return QFileInfo{file}.birthTime().toString(Qt::ISODateWithMs).toUtf8();
+}
+
+struct FileTailSettings {
+    int generation = 0;
+    QString fileName;
+    FileTailSource::Format format = FileTailSource::Csv;
+    int column = 0;
+    char separator = ',';
+    QString key;
+    int interval = 100;
+};
+
+/*
+ * Reads and parses new lines of a file, living in a separate thread.
+ */
+class FileTailWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    void start(const FileTailSettings &settings)
+    {
+        m_settings = settings;
+        m_offset = 0;
+        m_partial.clear();
+        m_skipLine = false;
+        m_identity.clear();
+
+        if (!m_timer) {
+            m_timer = new QTimer(this);
+            connect(m_timer, &QTimer::timeout, this, &FileTailWorker::read);
+        }
+
+        if (m_settings.fileName.isEmpty()) {
+            m_timer->stop();
+            return;
+        }
+
+        m_timer->start(std::max(m_settings.interval, 1));
+        read();
+    }
+
+    void setInterval(int interval)
+    {
+        m_settings.interval = interval;
+        if (m_timer && m_timer->isActive()) {
+            m_timer->setInterval(std::max(interval, 1));
+        }
+    }
+
+    Q_SIGNAL void valuesRead(int generation, const QList<qreal> &values, bool reset);
+
+private:
+    void queueRead()
+    {
+        if (!m_readQueued) {
+            m_readQueued = true;
+            QMetaObject::invokeMethod(this, &FileTailWorker::read, Qt::QueuedConnection);
+        }
+    }
+
+    void read()
+    {
+        m_readQueued = false;
+
+        QFile file{m_settings.fileName};
+        if (!file.open(QIODevice::ReadOnly)) {
+            return;
+        }
+
+        // If the file became smaller it was truncated, if it is a different
+        // file it was replaced. In both cases start reading from the
+        // beginning again.
+        bool reset = false;
+        const auto identity = fileIdentity(file);
+        if (file.size() < m_offset || (!m_identity.isEmpty() && identity != m_identity)) {
+            m_offset = 0;
+            m_partial.clear();
+            m_skipLine = false;
+            reset = true;
+        }
+        m_identity = identity;
+
+        if (file.size() == m_offset || !file.seek(m_offset)) {
+            if (reset) {
+                Q_EMIT valuesRead(m_settings.generation, {}, reset);
+            }
+            return;
+        }
+
+        QList<qreal> values;
+        for (int chunks = 0;; ++chunks) {
+            if (QThread::currentThread()->isInterruptionRequested()) {
+                break;
+            }
+
+            // Continue reading after other events were handled.
+            if (chunks == MaximumChunksPerRead) {
+                queueRead();
+                break;
+            }
+
+            const auto chunk = file.read(ChunkSize);
+            if (chunk.isEmpty()) {
+                break;
+            }
+
+            m_offset += chunk.size();
+            m_partial.append(chunk);
+
+            // Discard the rest of a line that was too long.
+            if (m_skipLine) {
+                const auto end = m_partial.indexOf('\n');
+                if (end < 0) {
+                    m_partial.clear();
+                    continue;
+                }
+                m_partial.remove(0, end + 1);
+                m_skipLine = false;
+            }
+
+            qsizetype lineStart = 0;
+            auto lineEnd = m_partial.indexOf('\n');
+            while (lineEnd >= 0) {
+                qreal value = 0.0;
+                if (parseLine(QByteArrayView{m_partial}.sliced(lineStart, lineEnd - lineStart), value)) {
+                    values.append(value);
+                }
+                lineStart = lineEnd + 1;
+                lineEnd = m_partial.indexOf('\n', lineStart);
+            }
+            // Keep any incomplete line around until the rest is written.
+            m_partial.remove(0, lineStart);
+
+            // Without a newline this would otherwise keep growing.
+            if (m_partial.size() > MaximumLineLength) {
+                m_partial.clear();
+                m_skipLine = true;
+            }
+
+            if (values.size() >= BatchSize) {
+                Q_EMIT valuesRead(m_settings.generation, values, reset);
+                values.clear();
+                reset = false;
+            }
+        }
+
+        if (!values.isEmpty() || reset) {
+            Q_EMIT valuesRead(m_settings.generation, values, reset);
+        }
+    }
+
+    bool parseLine(QByteArrayView line, qreal &value) const
+    {
+        line = line.trimmed();
+        if (line.isEmpty()) {
+            return false;
+        }
+
+        bool ok = false;
+        if (m_settings.format == FileTailSource::Csv) {
+            qsizetype start = 0;
+            for (int column = 0; column < m_settings.column; ++column) {
+                start = line.indexOf(m_settings.separator, start);
+                if (start < 0) {
+                    return false;
+                }
+                start++;
+            }
+
+            const auto end = line.indexOf(m_settings.separator, start);
+            auto field = line.sliced(start, (end < 0 ? line.size() : end) - start).trimmed();
+            if (field.size() >= 2 && field.startsWith('"') && field.endsWith('"')) {
+                field = field.sliced(1, field.size() - 2);
+            }
+            value = field.toDouble(&ok);
+        } else {
+            const auto jsonValue = QJsonDocument::fromJson(line.toByteArray()).object().value(m_settings.key);
+            ok = jsonValue.isDouble();
+            value = jsonValue.toDouble();
+        }
+
+        return ok;
+    }
+
+    FileTailSettings m_settings;
+    qint64 m_offset = 0;
+    QByteArray m_partial;
+    bool m_skipLine = false;
+    bool m_readQueued = false;
+    QByteArray m_identity;
+    QTimer *m_timer = nullptr;
+};
+
+FileTailSource::FileTailSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &FileTailSource::fileNameChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &FileTailSource::formatChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &FileTailSource::columnChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &FileTailSource::separatorChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &FileTailSource::keyChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &FileTailSource::maximumHistoryChanged, this, &ChartDataSource::dataChanged);
+
+    m_worker = new FileTailWorker;
+    m_worker->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_worker, &QObject::deleteLater);
+    connect(m_worker, &FileTailWorker::valuesRead, this, &FileTailSource::append);
+}
+
+FileTailSource::~FileTailSource()
+{
+    if (m_thread.isRunning()) {
+        // Stop a read that is still in progress as well.
+        m_thread.requestInterruption();
+        m_thread.quit();
+        m_thread.wait();
+    } else {
+        delete m_worker;
+    }
+}
+
+QString FileTailSource::fileName() const
+{
+    return m_fileName;
+}
+
+void FileTailSource::setFileName(const QString &newFileName)
+{
+    if (newFileName == m_fileName) {
+        return;
+    }
+
+    m_fileName = newFileName;
+    restart();
+    Q_EMIT fileNameChanged();
+}
+
+FileTailSource::Format FileTailSource::format() const
+{
+    return m_format;
+}
+
+void FileTailSource::setFormat(Format newFormat)
+{
+    if (newFormat == m_format) {
+        return;
+    }
+
+    m_format = newFormat;
+    restart();
+    Q_EMIT formatChanged();
+}
+
+int FileTailSource::column() const
+{
+    return m_column;
+}
+
+void FileTailSource::setColumn(int newColumn)
+{
+    if (newColumn == m_column) {
+        return;
+    }
+
+    m_column = newColumn;
+    restart();
+    Q_EMIT columnChanged();
+}
+
+QString FileTailSource::separator() const
+{
+    return m_separator;
+}
+
+void FileTailSource::setSeparator(const QString &newSeparator)
+{
+    if (newSeparator == m_separator) {
+        return;
+    }
+
+    m_separator = newSeparator;
+    restart();
+    Q_EMIT separatorChanged();
+}
+
+QString FileTailSource::key() const
+{
+    return m_key;
+}
+
+void FileTailSource::setKey(const QString &newKey)
+{
+    if (newKey == m_key) {
+        return;
+    }
+
+    m_key = newKey;
+    restart();
+    Q_EMIT keyChanged();
+}
+
+int FileTailSource::maximumHistory() const
+{
+    return m_maximumHistory;
+}
+
+void FileTailSource::setMaximumHistory(int newMaximumHistory)
+{
+    if (newMaximumHistory == m_maximumHistory) {
+        return;
+    }
+
+    m_maximumHistory = newMaximumHistory;
+    trim();
+    Q_EMIT maximumHistoryChanged();
+}
+
+int FileTailSource::interval() const
+{
+    return m_interval;
+}
+
+void FileTailSource::setInterval(int newInterval)
+{
+    if (newInterval == m_interval) {
+        return;
+    }
+
+    m_interval = newInterval;
+    QMetaObject::invokeMethod(m_worker, [worker = m_worker, newInterval]() {
+        worker->setInterval(newInterval);
+    });
+    Q_EMIT intervalChanged();
+}
+
+int FileTailSource::itemCount() const
+{
+    return int(m_values.size()) - m_start;
+}
+
+QVariant FileTailSource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    return m_values.at(m_start + index);
+}
+
+QVariant FileTailSource::minimum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    updateMinMax();
+    return m_minimum;
+}
+
+QVariant FileTailSource::maximum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    updateMinMax();
+    return m_maximum;
+}
+
+void FileTailSource::readValues(int start, int count, qreal *output) const
+{
+    const auto size = itemCount();
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < size ? m_values.at(m_start + index) : 0.0;
+    }
+}
+
+void FileTailSource::restart()
+{
+    // Results of any read that is still in progress are ignored by comparing
+    // against the generation.
+    m_generation++;
+    m_values.clear();
+    m_start = 0;
+    m_minMaxValid = false;
+
+    FileTailSettings settings;
+    settings.generation = m_generation;
+    settings.fileName = m_fileName;
+    settings.format = m_format;
+    settings.column = m_column;
+    settings.separator = m_separator.isEmpty() ? ',' : m_separator.at(0).toLatin1();
+    settings.key = m_key;
+    settings.interval = m_interval;
+
+    if (!m_thread.isRunning()) {
+        m_thread.start();
+    }
+
+    QMetaObject::invokeMethod(m_worker, [worker = m_worker, settings]() {
+        worker->start(settings);
+    });
+}
+
+void FileTailSource::append(int generation, const QList<qreal> &values, bool reset)
+{
+    if (generation != m_generation) {
+        return;
+    }
+
+    if (reset) {
+        m_values.clear();
+        m_start = 0;
+        m_minMaxValid = false;
+    }
+
+    const auto first = itemCount();
+    m_values.append(values);
+
+    if (m_minMaxValid) {
+        for (auto value : values) {
+            m_minimum = std::min(m_minimum, value);
+            m_maximum = std::max(m_maximum, value);
+        }
+    }
+
+    const auto removed = trim();
+
+    if (!reset && !removed) {
+        Q_EMIT itemsAppended(first, values.size());
+    }
+    Q_EMIT dataChanged();
+}
+
+bool FileTailSource::trim()
+{
+    if (m_maximumHistory <= 0 || itemCount() <= m_maximumHistory) {
+        return false;
+    }
+
+    m_start = int(m_values.size()) - m_maximumHistory;
+    m_minMaxValid = false;
+
+    // Only remove the discarded values once they make up half of the list, so
+    // the cost of removing them is spread over many batches.
+    if (m_start >= m_values.size() / 2) {
+        m_values.remove(0, m_start);
+        m_start = 0;
+    }
+
+    return true;
+}
+
+void FileTailSource::updateMinMax() const
+{
+    if (m_minMaxValid) {
+        return;
+    }
+
+    const auto [minimum, maximum] = std::minmax_element(m_values.cbegin() + m_start, m_values.cend());
+    m_minimum = *minimum;
+    m_maximum = *maximum;
+    m_minMaxValid = true;
+}
+
+#include "FileTailSource.moc"
+#include "moc_FileTailSource.cpp"
@@ -0,0 +1,173 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <QList>
+#include <QThread>
+#include <QVariant>
+
+class FileTailWorker;
+
+/*!
+ * \qmltype FileTailSource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A data source that reads values from a file that is being appended to.
+ *
+ * This source reads a text file containing one entry per line, either as
+ * comma-separated values or as JSON objects. Whenever lines are added to the
+ * file, they are read and the value of a specific column or key is added to
+ * the end of this source.
+ *
+ * Reading and parsing happens in a separate thread, new values are added in
+ * batches so large files do not block the user interface. When the file is
+ * truncated or replaced by a different file, it is read from the start again.
+ * Lines longer than 1 MiB are skipped.
+ */
+class QUICKCHARTS_EXPORT FileTailSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /*!
+     * \enum FileTailSource::Format
+     *
+     * The format of the file.
+     *
+     * \value Csv
+     *        Each line contains values separated by \l separator. The value of
+     *        \l column is used.
+     * \value Json
+     *        Each line contains a JSON object. The value of \l key is used.
+     */
+    enum Format {
+        Csv,
+        Json,
+    };
+    Q_ENUM(Format)
+
+    explicit FileTailSource(QObject *parent = nullptr);
+    ~FileTailSource() override;
+
+    /*!
+     * \qmlproperty string FileTailSource::fileName
+     * \brief The name of the file to read.
+     *
+     * \note Changing this property will clear all values.
+     */
+    Q_PROPERTY(QString fileName READ fileName WRITE setFileName NOTIFY fileNameChanged)
+    QString fileName() const;
+    void setFileName(const QString &newFileName);
+    Q_SIGNAL void fileNameChanged();
+    /*!
+     * \qmlproperty enumeration FileTailSource::format
+     * \qmlenumeratorsfrom FileTailSource::Format
+     * \brief The format of the file.
+     *
+     * The default is FileTailSource.Csv.
+     *
+     * \note Changing this property will clear all values.
+     */
+    Q_PROPERTY(Format format READ format WRITE setFormat NOTIFY formatChanged)
+    Format format() const;
+    void setFormat(Format newFormat);
+    Q_SIGNAL void formatChanged();
+    /*!
+     * \qmlproperty int FileTailSource::column
+     * \brief The column to read when format is FileTailSource.Csv.
+     *
+     * The default is 0.
+     *
+     * \note Changing this property will clear all values.
+     */
+    Q_PROPERTY(int column READ column WRITE setColumn NOTIFY columnChanged)
+    int column() const;
+    void setColumn(int newColumn);
+    Q_SIGNAL void columnChanged();
+    /*!
+     * \qmlproperty string FileTailSource::separator
+     * \brief The character separating columns when format is FileTailSource.Csv.
+     *
+     * The default is ",".
+     *
+     * \note Changing this property will clear all values.
+     */
+    Q_PROPERTY(QString separator READ separator WRITE setSeparator NOTIFY separatorChanged)
+    QString separator() const;
+    void setSeparator(const QString &newSeparator);
+    Q_SIGNAL void separatorChanged();
+    /*!
+     * \qmlproperty string FileTailSource::key
+     * \brief The key to read when format is FileTailSource.Json.
+     *
+     * \note Changing this property will clear all values.
+     */
+    Q_PROPERTY(QString key READ key WRITE setKey NOTIFY keyChanged)
+    QString key() const;
+    void setKey(const QString &newKey);
+    Q_SIGNAL void keyChanged();
+    /*!
+     * \qmlproperty int FileTailSource::maximumHistory
+     * \brief The maximum number of values to keep.
+     *
+     * When more values than this have been read, the oldest values are
+     * discarded. If this is less than or equal to 0, all values are kept.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int maximumHistory READ maximumHistory WRITE setMaximumHistory NOTIFY maximumHistoryChanged)
+    int maximumHistory() const;
+    void setMaximumHistory(int newMaximumHistory);
+    Q_SIGNAL void maximumHistoryChanged();
+    /*!
+     * \qmlproperty int FileTailSource::interval
+     * \brief The interval, in milliseconds, with which the file is checked for new lines.
+     *
+     * The default is 100.
+     */
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    int interval() const;
+    void setInterval(int newInterval);
+    Q_SIGNAL void intervalChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void restart();
+    void append(int generation, const QList<qreal> &values, bool reset);
+    bool trim();
+    void updateMinMax() const;
+
+    QString m_fileName;
+    Format m_format = Csv;
+    int m_column = 0;
+    QString m_separator = QStringLiteral(",");
+    QString m_key;
+    int m_maximumHistory = 0;
+    int m_interval = 100;
+
+    QThread m_thread;
+    FileTailWorker *m_worker = nullptr;
+    int m_generation = 0;
+
+    // Values before m_start were discarded because of maximumHistory, they
+    // are removed in batches.
+    QList<qreal> m_values;
+    int m_start = 0;
+    mutable bool m_minMaxValid = false;
+    mutable qreal m_minimum = 0.0;
+    mutable qreal m_maximum = 0.0;
+};
@@ -7,16 +7,147 @@
 
 #include "HistoryProxySource.h"
 
+#include <algorithm>
+
 #include <QDebug>
+#include <QHash>
+#include <QTimer>
+
+/*
+ * Provides the age of each item of a HistoryProxySource.
+ */
+class HistoryTimestampSource : public ChartDataSource
+{
+    Q_OBJECT
+
+public:
+    explicit HistoryTimestampSource(HistoryProxySource *history)
+        : ChartDataSource(history)
+        , m_history(history)
+    {
+        connect(history, &ChartDataSource::dataChanged, this, &ChartDataSource::dataChanged);
+    }
+
+    int itemCount() const override
+    {
+        return m_history->itemCount();
+    }
+
+    QVariant item(int index) const override
+    {
+        if (m_history->effectiveFillMode() == HistoryProxySource::FillFromEnd) {
+            index -= m_history->m_maximumHistory - m_history->m_timestamps.size();
+        }
+
+        if (index < 0 || index >= m_history->m_timestamps.size()) {
+            return QVariant{};
+        }
+
+        return m_history->m_timestamps.first() - m_history->m_timestamps.at(index);
+    }
+
+    QVariant minimum() const override
+    {
+        return m_history->m_timestamps.isEmpty() ? QVariant{} : QVariant{0};
+    }
+
+    QVariant maximum() const override
+    {
+        const auto &timestamps = m_history->m_timestamps;
+        return timestamps.isEmpty() ? QVariant{} : QVariant{timestamps.first() - timestamps.last()};
+    }
+
+private:
+    HistoryProxySource *m_history;
+};
+
+/*
+ * Samples all HistoryProxySources with the same interval using a single timer.
+ *
+ * This avoids waking up separately for each source and means all sources get
+ * updated in the same event loop iteration, so charts displaying several of
+ * them only need to update once.
+ */
+class HistorySampler : public QObject
+{
+    Q_OBJECT
+
+public:
+    static void add(HistoryProxySource *source, int interval)
+    {
+        auto &sampler = samplers()[interval];
+        if (!sampler) {
+            sampler = new HistorySampler(interval);
+        }
+        sampler->m_sources.append(source);
+    }
+
+    static void remove(HistoryProxySource *source, int interval)
+    {
+        auto sampler = samplers().value(interval);
+        if (!sampler) {
+            return;
+        }
+
+        sampler->m_sources.removeOne(source);
+        if (sampler->m_sources.isEmpty()) {
+            samplers().remove(interval);
+            // This may be called while sampling, so delay deletion.
+            sampler->deleteLater();
+        }
+    }
+
+private:
+    explicit HistorySampler(int interval)
+    {
+        // We need precise timers to avoid missing updates when dealing with semi-constantly
+        // updating source. That is, if the source updates at 500ms and we also update at that
+        // rate, a drift of 2ms can cause us to miss updates.
+        m_timer.setTimerType(Qt::PreciseTimer);
+        m_timer.setInterval(interval);
+        connect(&m_timer, &QTimer::timeout, this, &HistorySampler::sample);
+        m_timer.start();
+    }
+
+    void sample()
+    {
+        // Updating a source may lead to sources being added or removed, so
+        // iterate over a copy and skip anything that was removed since.
+        const auto sources = m_sources;
+        for (auto source : sources) {
+            if (m_sources.contains(source)) {
+                source->update();
+            }
+        }
+    }
+
+    static QHash<int, HistorySampler *> &samplers()
+    {
+        static QHash<int, HistorySampler *> samplers;
+        return samplers;
+    }
+
+    QTimer m_timer;
+    QList<HistoryProxySource *> m_sources;
+};
 
 HistoryProxySource::HistoryProxySource(QObject *parent)
     : ChartDataSource(parent)
 {
+    m_clock.start();
+    m_timestampSource = new HistoryTimestampSource(this);
+}
+
+HistoryProxySource::~HistoryProxySource()
+{
+    if (m_interval > 0) {
+        HistorySampler::remove(this, m_interval);
+    }
 }
 
 int HistoryProxySource::itemCount() const
 {
-    if (m_fillMode == DoNotFill) {
+    if (effectiveFillMode() == DoNotFill) {
         return m_history.size();
     } else {
         return m_maximumHistory;
@@ -29,15 +160,16 @@ QVariant HistoryProxySource::item(int index) const
         return QVariant{};
     }
 
-    if (m_fillMode == DoNotFill && index >= m_history.count()) {
+    const auto fillMode = effectiveFillMode();
+    if (fillMode == DoNotFill && index >= m_history.count()) {
         return QVariant{};
     }
 
-    if (m_fillMode == FillFromStart && index >= m_history.count()) {
+    if (fillMode == FillFromStart && index >= m_history.count()) {
         return QVariant{QMetaType(m_dataSource->item(0).userType())};
     }
 
-    if (m_fillMode == FillFromEnd && m_history.count() != m_maximumHistory) {
+    if (fillMode == FillFromEnd && m_history.count() != m_maximumHistory) {
         auto actualIndex = index - (m_maximumHistory - m_history.count());
         if (actualIndex < 0 || actualIndex >= m_history.size()) {
             return QVariant{QMetaType(m_dataSource->item(0).userType())};
@@ -118,7 +250,7 @@ void HistoryProxySource::setSource(ChartDataSource *newSource)
     clear();
     if (m_dataSource) {
         connect(m_dataSource, &ChartDataSource::dataChanged, this, [this]() {
-            if (!m_updateTimer) {
+            if (m_interval <= 0) {
                 update();
             }
         });
@@ -154,37 +286,54 @@ void HistoryProxySource::setMaximumHistory(int newMaximumHistory)
     }
 
     m_maximumHistory = newMaximumHistory;
-    while (m_history.size() > 0 && m_history.size() > m_maximumHistory) {
-        m_history.removeLast();
-    }
+    trim();
 
     Q_EMIT maximumHistoryChanged();
 }
 
+int HistoryProxySource::maximumAge() const
+{
+    return m_maximumAge;
+}
+
+void HistoryProxySource::setMaximumAge(int newMaximumAge)
+{
+    if (newMaximumAge == m_maximumAge) {
+        return;
+    }
+
+    m_maximumAge = newMaximumAge;
+    trim();
+
+    Q_EMIT maximumAgeChanged();
+    Q_EMIT dataChanged();
+}
+
+ChartDataSource *HistoryProxySource::timestampSource() const
+{
+    return m_timestampSource;
+}
+
 int HistoryProxySource::interval() const
 {
-    return m_updateTimer ? m_updateTimer->interval() : -1;
+    return m_interval;
 }
 
 void HistoryProxySource::setInterval(int newInterval)
 {
-    if (m_updateTimer && newInterval == m_updateTimer->interval()) {
+    newInterval = newInterval > 0 ? newInterval : -1;
+    if (newInterval == m_interval) {
         return;
     }
 
-    if (newInterval > 0) {
-        if (!m_updateTimer) {
-            m_updateTimer = std::make_unique<QTimer>();
-            // We need precise timers to avoid missing updates when dealing with semi-constantly
-            // updating source. That is, if the source updates at 500ms and we also update at that
-            // rate, a drift of 2ms can cause us to miss updates.
-            m_updateTimer->setTimerType(Qt::PreciseTimer);
-            connect(m_updateTimer.get(), &QTimer::timeout, this, &HistoryProxySource::update);
-        }
-        m_updateTimer->setInterval(newInterval);
-        m_updateTimer->start();
-    } else {
-        m_updateTimer.reset();
+    if (m_interval > 0) {
+        HistorySampler::remove(this, m_interval);
+    }
+
+    m_interval = newInterval;
+
+    if (m_interval > 0) {
+        HistorySampler::add(this, m_interval);
     }
 
     Q_EMIT intervalChanged();
@@ -209,6 +358,7 @@ void HistoryProxySource::setFillMode(FillMode newFillMode)
 void HistoryProxySource::clear()
 {
     m_history.clear();
+    m_timestamps.clear();
     Q_EMIT dataChanged();
 }
 
@@ -219,11 +369,39 @@ void HistoryProxySource::update()
     }
 
     m_history.prepend(m_dataSource->item(m_item));
-    while (m_history.size() > 0 && m_history.size() > m_maximumHistory) {
-        m_history.removeLast();
-    }
+    m_timestamps.prepend(m_clock.elapsed());
+    trim();
 
     Q_EMIT dataChanged();
 }
 
+void HistoryProxySource::trim()
+{
+    // History is ordered from newest to oldest, so items to discard are always
+    // at the end. Since QList reserves space at its start when prepending,
+    // this makes both adding and discarding items constant time.
+    if (m_maximumAge > 0) {
+        if (m_timestamps.isEmpty()) {
+            return;
+        }
+
+        const auto oldest = m_timestamps.first() - m_maximumAge;
+        while (m_timestamps.last() < oldest) {
+            m_history.removeLast();
+            m_timestamps.removeLast();
+        }
+    } else {
+        while (m_history.size() > 0 && m_history.size() > m_maximumHistory) {
+            m_history.removeLast();
+            m_timestamps.removeLast();
+        }
+    }
+}
+
+HistoryProxySource::FillMode HistoryProxySource::effectiveFillMode() const
+{
+    return m_maximumAge > 0 ? DoNotFill : m_fillMode;
+}
+
+#include "HistoryProxySource.moc"
 #include "moc_HistoryProxySource.cpp"
@@ -8,13 +8,15 @@
 #ifndef HISTORYPROXYSOURCE_H
 #define HISTORYPROXYSOURCE_H
 
+#include <QElapsedTimer>
 #include <QList>
-#include <QTimer>
 #include <QVariant>
-#include <memory>
 
 #include "ChartDataSource.h"
 
+class HistorySampler;
+class HistoryTimestampSource;
+
 /*!
  * \qmltype HistoryProxySource
  * \inherits ChartDataSource
@@ -62,6 +64,7 @@ public:
     Q_ENUM(FillMode)
 
     explicit HistoryProxySource(QObject *parent = nullptr);
+    ~HistoryProxySource() override;
 
     /*!
      * \qmlproperty ChartDataSource HistoryProxySource::source
@@ -101,6 +104,39 @@ public:
     int maximumHistory() const;
     void setMaximumHistory(int maximumHistory);
     Q_SIGNAL void maximumHistoryChanged();
+    /*!
+     * \qmlproperty int HistoryProxySource::maximumAge
+     * \brief The maximum age of history to keep, in milliseconds.
+     *
+     * If set to a value > 0, items are kept based on when they were recorded
+     * rather than on the number of items. \l maximumHistory is then ignored
+     * and fillMode behaves as DoNotFill.
+     *
+     * The age of an item is measured from the newest item, not from the
+     * current time. Items are only discarded when a new item is recorded, so
+     * if the source stops changing, the last items are kept regardless of
+     * how long ago they were recorded.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int maximumAge READ maximumAge WRITE setMaximumAge NOTIFY maximumAgeChanged)
+    int maximumAge() const;
+    void setMaximumAge(int newMaximumAge);
+    Q_SIGNAL void maximumAgeChanged();
+    /*!
+     * \qmlproperty ChartDataSource HistoryProxySource::timestampSource
+     * \brief A data source providing the age of each item, in milliseconds.
+     *
+     * Ages are relative to the newest item, so they increase with the index
+     * of the item. This can be used as the xValueSource of a chart to display
+     * items at the time they were recorded, even if they were not recorded at
+     * regular intervals.
+     *
+     * \note Items without recorded history, as used by fillMode, do not have
+     * an age.
+     */
+    Q_PROPERTY(ChartDataSource *timestampSource READ timestampSource CONSTANT)
+    ChartDataSource *timestampSource() const;
     /*!
      * \qmlproperty int HistoryProxySource::interval
      * \brief The interval, in milliseconds, with which to query the data source.
@@ -110,6 +146,9 @@ public:
      * and a new item will be added with whatever value it has at that point,
      * even if it did not change.
      *
+     * All sources using the same interval are sampled together, so they only
+     * cause a single update of any charts using them.
+     *
      * The default is 0.
      */
     Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
@@ -145,14 +184,24 @@ public:
     QVariant first() const override;
 
 private:
+    friend class HistorySampler;
+    friend class HistoryTimestampSource;
+
     void update();
+    void trim();
+    FillMode effectiveFillMode() const;
 
     ChartDataSource *m_dataSource = nullptr;
     int m_item = 0;
     int m_maximumHistory = 10;
     FillMode m_fillMode = DoNotFill;
-    std::unique_ptr<QTimer> m_updateTimer;
+    int m_interval = -1;
+    int m_maximumAge = 0;
     QList<QVariant> m_history;
+    // When each item in m_history was recorded, in milliseconds since m_clock started.
+    QList<qint64> m_timestamps;
+    QElapsedTimer m_clock;
+    HistoryTimestampSource *m_timestampSource = nullptr;
 };
 
 #endif // HISTORYPROXYSOURCE_H
@@ -6,6 +6,9 @@
 
 #include "MapProxySource.h"
 
+#include <cmath>
+#include <limits>
+
 MapProxySource::MapProxySource(QObject *parent)
     : ChartDataSource(parent)
 {
@@ -24,34 +27,25 @@ int MapProxySource::itemCount() const
 
 QVariant MapProxySource::minimum() const
 {
-    auto itr = std::min_element(m_map.cbegin(), m_map.cend(), variantCompare);
-    if (itr != m_map.cend()) {
-        return *itr;
-    }
-    return QVariant{};
+    update();
+    return m_minimum;
 }
 
 QVariant MapProxySource::maximum() const
 {
-    auto itr = std::max_element(m_map.cbegin(), m_map.cend(), variantCompare);
-    if (itr != m_map.cend()) {
-        return *itr;
-    }
-    return QVariant{};
+    update();
+    return m_maximum;
 }
 
 QVariant MapProxySource::item(int index) const
 {
-    if (!m_source) {
-        return QVariant{};
-    }
+    update();
 
-    auto mapIndex = m_source->item(index).toString();
-    if (mapIndex.isEmpty()) {
+    if (index < 0 || index >= m_values.size()) {
         return QVariant{};
     }
 
-    return m_map.value(mapIndex);
+    return m_values.at(index);
 }
 
 ChartDataSource *MapProxySource::source() const
@@ -70,8 +64,12 @@ void MapProxySource::setSource(ChartDataSource *newSource)
     }
 
     m_source = newSource;
+    m_valid = false;
     if (m_source) {
-        connect(m_source, &ChartDataSource::dataChanged, this, &ChartDataSource::dataChanged);
+        connect(m_source, &ChartDataSource::dataChanged, this, [this]() {
+            m_valid = false;
+            Q_EMIT dataChanged();
+        });
     }
     Q_EMIT sourceChanged();
 }
@@ -89,7 +87,103 @@ void MapProxySource::setMap(const QVariantMap &newMap)
 
     m_map = newMap;
 
+    m_stringKeys.clear();
+    m_integerKeys.clear();
+    for (auto itr = m_map.cbegin(); itr != m_map.cend(); ++itr) {
+        bool ok = false;
+        const auto integer = itr.key().toLongLong(&ok);
+        // Only use keys that are exactly what converting the integer to a
+        // string would produce, so "01" is not matched by 1.
+        if (ok && QString::number(integer) == itr.key()) {
+            m_integerKeys.insert(integer, itr.value());
+        } else {
+            m_stringKeys.insert(itr.key(), itr.value());
+        }
+    }
+    m_valid = false;
+
     Q_EMIT mapChanged();
 }
 
+QVariant MapProxySource::lookup(const QVariant &key) const
+{
+    switch (key.typeId()) {
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::LongLong:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+        return m_integerKeys.value(key.toLongLong());
+    case QMetaType::ULongLong:
+        if (key.toULongLong() <= quint64(std::numeric_limits<qint64>::max())) {
+            return m_integerKeys.value(key.toLongLong());
+        }
+        break;
+    case QMetaType::Float:
+    case QMetaType::Double: {
+        // Numbers from QML are always doubles, so look up integral values as
+        // integers.
+        const auto number = key.toDouble();
+        if (std::trunc(number) == number && std::abs(number) < 1e18) {
+            return m_integerKeys.value(qint64(number));
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    const auto string = key.toString();
+    if (string.isEmpty()) {
+        return QVariant{};
+    }
+
+    auto itr = m_stringKeys.constFind(string);
+    if (itr != m_stringKeys.constEnd()) {
+        return itr.value();
+    }
+
+    // Strings and other values can still match integer keys, like the string
+    // "1". As with the keys, only match the exact string of the integer.
+    bool ok = false;
+    const auto integer = string.toLongLong(&ok);
+    if (ok && QString::number(integer) == string) {
+        return m_integerKeys.value(integer);
+    }
+
+    return QVariant{};
+}
+
+void MapProxySource::update() const
+{
+    if (m_valid) {
+        return;
+    }
+
+    m_values.clear();
+    m_minimum = QVariant{};
+    m_maximum = QVariant{};
+
+    const auto count = itemCount();
+    m_values.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const auto value = lookup(m_source->item(i));
+        m_values.append(value);
+
+        if (!value.isValid()) {
+            continue;
+        }
+
+        if (!m_minimum.isValid() || variantCompare(value, m_minimum)) {
+            m_minimum = value;
+        }
+        if (!m_maximum.isValid() || variantCompare(m_maximum, value)) {
+            m_maximum = value;
+        }
+    }
+
+    m_valid = true;
+}
+
 #include "moc_MapProxySource.cpp"
@@ -8,6 +8,8 @@
 
 #include "ChartDataSource.h"
 
+#include <QHash>
+#include <QList>
 #include <QVariant>
 
 /*!
@@ -20,6 +22,10 @@
  * This source reads values from another source, then uses those as an index to
  * a map of different values and returns the appropriate value from that map.
  * This source's itemCount matches that of the other source.
+ *
+ * The mapped values are cached, so they are only looked up again when either
+ * the source or the map changes. minimum and maximum are the minimum and
+ * maximum of the mapped values.
  */
 class QUICKCHARTS_EXPORT MapProxySource : public ChartDataSource
 {
@@ -53,6 +59,19 @@ public:
     QVariant maximum() const override;
 
 private:
+    QVariant lookup(const QVariant &key) const;
+    void update() const;
+
     ChartDataSource *m_source = nullptr;
     QVariantMap m_map;
+
+    // The map, indexed for faster lookups. Keys that are integers are stored
+    // separately so integer values do not need to be converted to a string.
+    QHash<QString, QVariant> m_stringKeys;
+    QHash<qint64, QVariant> m_integerKeys;
+
+    mutable bool m_valid = false;
+    mutable QList<QVariant> m_values;
+    mutable QVariant m_minimum;
+    mutable QVariant m_maximum;
 };
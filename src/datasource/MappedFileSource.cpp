@@ -0,0 +1,212 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "MappedFileSource.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <QtEndian>
+
+#include "charts_datasource_logging.h"
+
+static const char Magic[] = {'K', 'Q', 'C', 'B'};
+static const quint32 Version = 1;
+static const qint64 HeaderSize = 24;
+static const qint64 ColumnHeaderSize = 24;
+
+MappedFileSource::MappedFileSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &MappedFileSource::fileNameChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &MappedFileSource::columnChanged, this, &ChartDataSource::dataChanged);
+}
+
+MappedFileSource::~MappedFileSource()
+{
+    unload();
+}
+
+QString MappedFileSource::fileName() const
+{
+    return m_fileName;
+}
+
+void MappedFileSource::setFileName(const QString &newFileName)
+{
+    if (newFileName == m_fileName) {
+        return;
+    }
+
+    m_fileName = newFileName;
+    load();
+    Q_EMIT fileNameChanged();
+}
+
+int MappedFileSource::column() const
+{
+    return m_column;
+}
+
+void MappedFileSource::setColumn(int newColumn)
+{
+    if (newColumn == m_column) {
+        return;
+    }
+
+    m_column = newColumn;
+    Q_EMIT columnChanged();
+}
+
+int MappedFileSource::columnCount() const
+{
+    return m_columns.size();
+}
+
+int MappedFileSource::itemCount() const
+{
+    if (m_column < 0 || m_column >= m_columns.size()) {
+        return 0;
+    }
+
+    return m_rowCount;
+}
+
+QVariant MappedFileSource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    return value(m_columns.at(m_column), index);
+}
+
+QVariant MappedFileSource::minimum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    return m_columns.at(m_column).minimum;
+}
+
+QVariant MappedFileSource::maximum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    return m_columns.at(m_column).maximum;
+}
+
+void MappedFileSource::readValues(int start, int count, qreal *output) const
+{
+    const auto rowCount = itemCount();
+    if (rowCount == 0) {
+        std::fill_n(output, count, 0.0);
+        return;
+    }
+
+    const auto &column = m_columns.at(m_column);
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < rowCount ? value(column, index) : 0.0;
+    }
+}
+
+void MappedFileSource::load()
+{
+    unload();
+
+    if (m_fileName.isEmpty()) {
+        return;
+    }
+
+    m_file.setFileName(m_fileName);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        qCWarning(DATASOURCE) << "MappedFileSource: Could not open" << m_fileName << m_file.errorString();
+        return;
+    }
+
+    const auto fileSize = m_file.size();
+    auto data = fileSize >= HeaderSize ? m_file.map(0, fileSize) : nullptr;
+    if (!data || memcmp(data, Magic, sizeof(Magic)) != 0 || qFromLittleEndian<quint32>(data + 4) != Version) {
+        qCWarning(DATASOURCE) << "MappedFileSource:" << m_fileName << "is not a valid file";
+        unload();
+        return;
+    }
+
+    const auto columnCount = qint64(qFromLittleEndian<quint32>(data + 8));
+    const auto rowCount = qFromLittleEndian<quint64>(data + 16);
+    if (rowCount > quint64(std::numeric_limits<int>::max())) {
+        qCWarning(DATASOURCE) << "MappedFileSource:" << m_fileName << "contains too many rows";
+        unload();
+        return;
+    }
+
+    auto offset = HeaderSize + columnCount * ColumnHeaderSize;
+    if (offset > fileSize) {
+        qCWarning(DATASOURCE) << "MappedFileSource:" << m_fileName << "is truncated";
+        unload();
+        return;
+    }
+
+    QList<Column> columns;
+    columns.reserve(columnCount);
+    for (qint64 i = 0; i < columnCount; ++i) {
+        auto columnHeader = data + HeaderSize + i * ColumnHeaderSize;
+
+        Column column;
+        column.type = ColumnType(qFromLittleEndian<quint32>(columnHeader));
+        column.offset = offset;
+        column.minimum = qFromLittleEndian<double>(columnHeader + 8);
+        column.maximum = qFromLittleEndian<double>(columnHeader + 16);
+
+        if (column.type != Float && column.type != Double) {
+            qCWarning(DATASOURCE) << "MappedFileSource: Column" << i << "of" << m_fileName << "has an unknown type";
+            unload();
+            return;
+        }
+
+        offset += qint64(rowCount) * qint64(column.type == Float ? sizeof(float) : sizeof(double));
+        if (offset > fileSize) {
+            qCWarning(DATASOURCE) << "MappedFileSource:" << m_fileName << "is truncated";
+            unload();
+            return;
+        }
+
+        columns.append(column);
+    }
+
+    m_data = data;
+    m_rowCount = int(rowCount);
+    m_columns = columns;
+}
+
+void MappedFileSource::unload()
+{
+    if (m_file.isOpen()) {
+        // Closing the file also unmaps it.
+        m_file.close();
+    }
+
+    m_data = nullptr;
+    m_rowCount = 0;
+    m_columns.clear();
+}
+
+qreal MappedFileSource::value(const Column &column, int index) const
+{
+    if (column.type == Float) {
+        return qFromLittleEndian<float>(m_data + column.offset + index * qint64(sizeof(float)));
+    } else {
+        return qFromLittleEndian<double>(m_data + column.offset + index * qint64(sizeof(double)));
+    }
+}
+
+#include "moc_MappedFileSource.cpp"
@@ -0,0 +1,107 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <QFile>
+#include <QList>
+#include <QVariant>
+
+/*!
+ * \qmltype MappedFileSource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A data source that reads values from a memory-mapped binary file.
+ *
+ * This source maps a file into memory and reads the values of a single
+ * column directly from that mapping. Loading is independent of the size of
+ * the file and only the parts of the file that are actually read will be
+ * loaded into memory.
+ *
+ * Files should use the following format, with all numbers stored as little
+ * endian:
+ *
+ * \list
+ * \li A header of 24 bytes, containing the characters "KQCB", a 32-bit
+ *     unsigned version number that should be 1, a 32-bit unsigned column
+ *     count, 4 bytes of padding and a 64-bit unsigned row count.
+ * \li A column description of 24 bytes for each column, containing a 32-bit
+ *     unsigned type, 4 bytes of padding, and the minimum and maximum value of
+ *     the column as 64-bit floats. The type should be 1 for 32-bit floats and
+ *     2 for 64-bit floats.
+ * \li The values of each column, stored one column after another, with each
+ *     column containing row count values.
+ * \endlist
+ */
+class QUICKCHARTS_EXPORT MappedFileSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    explicit MappedFileSource(QObject *parent = nullptr);
+    ~MappedFileSource() override;
+
+    /*!
+     * \qmlproperty string MappedFileSource::fileName
+     * \brief The name of the file to read values from.
+     */
+    Q_PROPERTY(QString fileName READ fileName WRITE setFileName NOTIFY fileNameChanged)
+    QString fileName() const;
+    void setFileName(const QString &newFileName);
+    Q_SIGNAL void fileNameChanged();
+    /*!
+     * \qmlproperty int MappedFileSource::column
+     * \brief The column of the file to read values from.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int column READ column WRITE setColumn NOTIFY columnChanged)
+    int column() const;
+    void setColumn(int newColumn);
+    Q_SIGNAL void columnChanged();
+    /*!
+     * \qmlproperty int MappedFileSource::columnCount
+     * \brief The number of columns in the file.
+     */
+    Q_PROPERTY(int columnCount READ columnCount NOTIFY dataChanged)
+    int columnCount() const;
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    enum ColumnType : quint32 {
+        Float = 1,
+        Double = 2,
+    };
+
+    struct Column {
+        ColumnType type = Double;
+        qint64 offset = 0;
+        qreal minimum = 0.0;
+        qreal maximum = 0.0;
+    };
+
+    void load();
+    void unload();
+    qreal value(const Column &column, int index) const;
+
+    QString m_fileName;
+    int m_column = 0;
+
+    QFile m_file;
+    const uchar *m_data = nullptr;
+    int m_rowCount = 0;
+    QList<Column> m_columns;
+};
@@ -204,7 +204,12 @@ void ModelSource::setModel(QAbstractItemModel *model)
 
     m_model = model;
     if (m_model) {
-        connect(m_model, &QAbstractItemModel::rowsInserted, this, &ModelSource::dataChanged);
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, [this](const QModelIndex &parent, int first, int last) {
+            if (!m_indexColumns && !parent.isValid() && last == m_model->rowCount() - 1) {
+                Q_EMIT itemsAppended(first, last - first + 1);
+            }
+            Q_EMIT dataChanged();
+        });
         connect(m_model, &QAbstractItemModel::rowsRemoved, this, &ModelSource::dataChanged);
         connect(m_model, &QAbstractItemModel::rowsMoved, this, &ModelSource::dataChanged);
         connect(m_model, &QAbstractItemModel::modelReset, this, &ModelSource::dataChanged);
@@ -0,0 +1,347 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "RollingProxySource.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+RollingProxySource::RollingProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &RollingProxySource::statisticChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &RollingProxySource::windowSizeChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &RollingProxySource::percentileChanged, this, &ChartDataSource::dataChanged);
+    connect(this, &RollingProxySource::reversedChanged, this, &ChartDataSource::dataChanged);
+}
+
+ChartDataSource *RollingProxySource::source() const
+{
+    return m_source;
+}
+
+void RollingProxySource::setSource(ChartDataSource *newSource)
+{
+    if (newSource == m_source) {
+        return;
+    }
+
+    if (m_source) {
+        m_source->disconnect(this);
+    }
+
+    m_source = newSource;
+    if (m_source) {
+        connect(m_source, &ChartDataSource::itemsAppended, this, [this](int first) {
+            m_appendedFirst = first;
+        });
+        connect(m_source, &ChartDataSource::dataChanged, this, [this]() {
+            // Appending items does not change the window of existing items,
+            // unless the window contains the items after an item.
+            const auto appended = !m_reversed && m_appendedFirst >= 0 && m_appendedFirst == m_values.size();
+            const auto first = appended ? m_appendedFirst : 0;
+            m_appendedFirst = -1;
+
+            update(first);
+
+            if (appended && m_values.size() > first) {
+                Q_EMIT itemsAppended(first, m_values.size() - first);
+            }
+            Q_EMIT dataChanged();
+        });
+        connect(m_source, &QObject::destroyed, this, [this]() {
+            m_source = nullptr;
+            update(0);
+            Q_EMIT dataChanged();
+        });
+    }
+
+    update(0);
+    Q_EMIT sourceChanged();
+    Q_EMIT dataChanged();
+}
+
+RollingProxySource::Statistic RollingProxySource::statistic() const
+{
+    return m_statistic;
+}
+
+void RollingProxySource::setStatistic(Statistic newStatistic)
+{
+    if (newStatistic == m_statistic) {
+        return;
+    }
+
+    m_statistic = newStatistic;
+    update(0);
+    Q_EMIT statisticChanged();
+}
+
+int RollingProxySource::windowSize() const
+{
+    return m_windowSize;
+}
+
+void RollingProxySource::setWindowSize(int newWindowSize)
+{
+    newWindowSize = std::max(newWindowSize, 1);
+    if (newWindowSize == m_windowSize) {
+        return;
+    }
+
+    m_windowSize = newWindowSize;
+    update(0);
+    Q_EMIT windowSizeChanged();
+}
+
+qreal RollingProxySource::percentile() const
+{
+    return m_percentile;
+}
+
+void RollingProxySource::setPercentile(qreal newPercentile)
+{
+    newPercentile = std::clamp(newPercentile, 0.0, 100.0);
+    if (qFuzzyCompare(newPercentile, m_percentile)) {
+        return;
+    }
+
+    m_percentile = newPercentile;
+    update(0);
+    Q_EMIT percentileChanged();
+}
+
+bool RollingProxySource::reversed() const
+{
+    return m_reversed;
+}
+
+void RollingProxySource::setReversed(bool newReversed)
+{
+    if (newReversed == m_reversed) {
+        return;
+    }
+
+    m_reversed = newReversed;
+    update(0);
+    Q_EMIT reversedChanged();
+}
+
+int RollingProxySource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant RollingProxySource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant RollingProxySource::minimum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    return m_minimum;
+}
+
+QVariant RollingProxySource::maximum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    return m_maximum;
+}
+
+void RollingProxySource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < m_values.size() ? m_values.at(index) : 0.0;
+    }
+}
+
+void RollingProxySource::update(int first)
+{
+    const auto count = m_source ? m_source->itemCount() : 0;
+    first = std::min(first, count);
+    m_values.resize(count);
+
+    if (first == count) {
+        return;
+    }
+
+    // Items before first that are part of the window of first need to be
+    // read as well.
+    const auto start = std::max(first - m_windowSize + 1, 0);
+    QList<qreal> input(count - start);
+    m_source->readValues(start, input.size(), input.data());
+
+    // When reversed, first is always 0, so we can simply calculate the
+    // statistics over the reversed input.
+    if (m_reversed) {
+        std::reverse(input.begin(), input.end());
+    }
+
+    switch (m_statistic) {
+    case Mean:
+        calculateMean(input.constData(), start, first);
+        break;
+    case ExponentialMean:
+        calculateExponentialMean(input.constData(), start, first);
+        break;
+    case Percentile:
+        calculatePercentile(input.constData(), start, first);
+        break;
+    }
+
+    if (m_reversed) {
+        std::reverse(m_values.begin(), m_values.end());
+    }
+
+    // Values before first did not change, so only the new values need to be
+    // included in minimum and maximum. fmin and fmax skip windows without any
+    // valid values.
+    auto minimum = first > 0 ? m_minimum : qQNaN();
+    auto maximum = first > 0 ? m_maximum : qQNaN();
+    for (auto itr = m_values.cbegin() + first; itr != m_values.cend(); ++itr) {
+        minimum = std::fmin(minimum, *itr);
+        maximum = std::fmax(maximum, *itr);
+    }
+    m_minimum = minimum;
+    m_maximum = maximum;
+}
+
+void RollingProxySource::calculateMean(const qreal *input, int start, int first)
+{
+    // Only the valid values in the window are counted, since a single NaN or
+    // infinity would otherwise remain part of the sum after leaving the window.
+    qreal sum = 0.0;
+    int count = 0;
+
+    auto add = [&](qreal value) {
+        if (std::isfinite(value)) {
+            sum += value;
+            ++count;
+        }
+    };
+
+    auto remove = [&](qreal value) {
+        if (std::isfinite(value)) {
+            sum -= value;
+            --count;
+        }
+    };
+
+    for (int index = start; index < first; ++index) {
+        add(input[index - start]);
+    }
+
+    for (int index = first; index < m_values.size(); ++index) {
+        add(input[index - start]);
+        if (index - m_windowSize >= start) {
+            remove(input[index - m_windowSize - start]);
+        }
+
+        m_values[index] = count > 0 ? sum / count : qQNaN();
+    }
+}
+
+void RollingProxySource::calculateExponentialMean(const qreal *input, int start, int first)
+{
+    const auto factor = 2.0 / (m_windowSize + 1);
+
+    // Until the first valid value, previous is NaN.
+    auto previous = first > 0 ? m_values.at(first - 1) : qQNaN();
+    for (int index = first; index < m_values.size(); ++index) {
+        const auto value = input[index - start];
+        if (std::isfinite(value)) {
+            previous = std::isnan(previous) ? value : factor * value + (1.0 - factor) * previous;
+        }
+        m_values[index] = previous;
+    }
+}
+
+void RollingProxySource::calculatePercentile(const qreal *input, int start, int first)
+{
+    // The window is split into the lowest rank items and the rest, so the
+    // percentile is always the largest of the lowest items. This makes adding
+    // and removing items O(log windowSize).
+    //
+    // NaN cannot be ordered and would break the multisets, so values that are
+    // not finite are never added to or removed from them.
+    std::multiset<qreal> lower;
+    std::multiset<qreal> upper;
+
+    auto add = [&](qreal value) {
+        if (!std::isfinite(value)) {
+            return;
+        }
+
+        if (!lower.empty() && value <= *lower.rbegin()) {
+            lower.insert(value);
+        } else {
+            upper.insert(value);
+        }
+    };
+
+    auto remove = [&](qreal value) {
+        if (!std::isfinite(value)) {
+            return;
+        }
+
+        if (!lower.empty() && value <= *lower.rbegin()) {
+            lower.erase(lower.find(value));
+        } else {
+            upper.erase(upper.find(value));
+        }
+    };
+
+    auto balance = [&](std::size_t rank) {
+        while (lower.size() > rank) {
+            auto last = std::prev(lower.end());
+            upper.insert(*last);
+            lower.erase(last);
+        }
+        while (lower.size() < rank && !upper.empty()) {
+            lower.insert(*upper.begin());
+            upper.erase(upper.begin());
+        }
+    };
+
+    for (int index = start; index < first; ++index) {
+        add(input[index - start]);
+    }
+
+    for (int index = first; index < m_values.size(); ++index) {
+        add(input[index - start]);
+        if (index - m_windowSize >= start) {
+            remove(input[index - m_windowSize - start]);
+        }
+
+        const auto size = int(lower.size() + upper.size());
+        if (size == 0) {
+            m_values[index] = qQNaN();
+            continue;
+        }
+
+        // Use the nearest rank, which is always one of the items in the window.
+        const auto rank = std::clamp(int(std::ceil(m_percentile / 100.0 * size)), 1, size);
+        balance(rank);
+
+        m_values[index] = *lower.rbegin();
+    }
+}
+
+#include "moc_RollingProxySource.cpp"
@@ -0,0 +1,150 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <QList>
+#include <QVariant>
+
+/*!
+ * \qmltype RollingProxySource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A source that provides rolling statistics of a different source.
+ *
+ * For each item of another source, this source provides a statistic over a
+ * window of \l windowSize items ending at that item, for example to smooth a
+ * noisy source. Near the start of the source, the window contains fewer
+ * items.
+ *
+ * Items that are not finite, like NaN, are left out of the window. If a
+ * window contains no finite items at all, the statistic is NaN.
+ *
+ * If the source emits itemsAppended, only statistics for the new items are
+ * calculated.
+ *
+ * \section1 Usage with HistoryProxySource
+ *
+ * HistoryProxySource provides the newest item first. To have the window
+ * contain older items, set \l reversed to true:
+ *
+ * \qml
+ * RollingProxySource {
+ *     source: HistoryProxySource { ... }
+ *     statistic: RollingProxySource.Mean
+ *     windowSize: 5
+ *     reversed: true
+ * }
+ * \endqml
+ */
+class QUICKCHARTS_EXPORT RollingProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /*!
+     * \enum RollingProxySource::Statistic
+     *
+     * The statistic to calculate.
+     *
+     * \value Mean
+     *        The average of all items in the window.
+     * \value ExponentialMean
+     *        An exponentially weighted moving average. Each item is weighted
+     *        using a factor of 2 / (windowSize + 1), with older items
+     *        contributing less.
+     * \value Percentile
+     *        The value below which \l percentile percent of the items in the
+     *        window fall. A percentile of 50 results in the median.
+     */
+    enum Statistic {
+        Mean,
+        ExponentialMean,
+        Percentile,
+    };
+    Q_ENUM(Statistic)
+
+    explicit RollingProxySource(QObject *parent = nullptr);
+
+    /*!
+     * \qmlproperty ChartDataSource RollingProxySource::source
+     * \brief The source to read items from.
+     */
+    Q_PROPERTY(ChartDataSource *source READ source WRITE setSource NOTIFY sourceChanged)
+    ChartDataSource *source() const;
+    void setSource(ChartDataSource *newSource);
+    Q_SIGNAL void sourceChanged();
+    /*!
+     * \qmlproperty enumeration RollingProxySource::statistic
+     * \qmlenumeratorsfrom RollingProxySource::Statistic
+     * \brief The statistic to calculate.
+     *
+     * The default is RollingProxySource.Mean.
+     */
+    Q_PROPERTY(Statistic statistic READ statistic WRITE setStatistic NOTIFY statisticChanged)
+    Statistic statistic() const;
+    void setStatistic(Statistic newStatistic);
+    Q_SIGNAL void statisticChanged();
+    /*!
+     * \qmlproperty int RollingProxySource::windowSize
+     * \brief The number of items to calculate the statistic over.
+     *
+     * The default is 10.
+     */
+    Q_PROPERTY(int windowSize READ windowSize WRITE setWindowSize NOTIFY windowSizeChanged)
+    int windowSize() const;
+    void setWindowSize(int newWindowSize);
+    Q_SIGNAL void windowSizeChanged();
+    /*!
+     * \qmlproperty real RollingProxySource::percentile
+     * \brief The percentile to calculate when statistic is RollingProxySource.Percentile.
+     *
+     * This should be between 0 and 100. The default is 50.
+     */
+    Q_PROPERTY(qreal percentile READ percentile WRITE setPercentile NOTIFY percentileChanged)
+    qreal percentile() const;
+    void setPercentile(qreal newPercentile);
+    Q_SIGNAL void percentileChanged();
+    /*!
+     * \qmlproperty bool RollingProxySource::reversed
+     * \brief Whether the window contains the items after an item instead of before it.
+     *
+     * This should be set to true for sources that provide the newest item
+     * first. The default is false.
+     */
+    Q_PROPERTY(bool reversed READ reversed WRITE setReversed NOTIFY reversedChanged)
+    bool reversed() const;
+    void setReversed(bool newReversed);
+    Q_SIGNAL void reversedChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void update(int first);
+    void calculateMean(const qreal *input, int start, int first);
+    void calculateExponentialMean(const qreal *input, int start, int first);
+    void calculatePercentile(const qreal *input, int start, int first);
+
+    ChartDataSource *m_source = nullptr;
+    Statistic m_statistic = Mean;
+    int m_windowSize = 10;
+    qreal m_percentile = 50.0;
+    bool m_reversed = false;
+
+    QList<qreal> m_values;
+    int m_appendedFirst = -1;
+    qreal m_minimum = 0.0;
+    qreal m_maximum = 0.0;
+};
@@ -0,0 +1,203 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "StreamSource.h"
+
+#include <QtMath>
+
+#include "charts_datasource_logging.h"
+
+StreamSource::Buffer::Buffer(int capacity)
+    : capacity(qNextPowerOfTwo(quint64(std::max(capacity, 2) - 1)))
+    , mask(this->capacity - 1)
+    , values(std::make_unique<qreal[]>(this->capacity))
+{
+}
+
+StreamSource::StreamSource(QObject *parent)
+    : ChartDataSource(parent)
+{
+    connect(this, &StreamSource::maximumHistoryChanged, this, &ChartDataSource::dataChanged);
+
+    m_buffer = std::make_shared<Buffer>(m_requestedCapacity);
+
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(16);
+    connect(&m_timer, &QTimer::timeout, this, &StreamSource::drain);
+}
+
+StreamSource::Producer StreamSource::producer()
+{
+    if (m_buffer->hasProducer.exchange(true, std::memory_order_acq_rel)) {
+        qCWarning(DATASOURCE) << "StreamSource: Only a single producer is supported, values of this producer are discarded";
+        return Producer{};
+    }
+
+    m_timer.start();
+    return Producer{m_buffer};
+}
+
+int StreamSource::capacity() const
+{
+    return int(m_buffer->capacity);
+}
+
+void StreamSource::setCapacity(int newCapacity)
+{
+    if (newCapacity == m_requestedCapacity) {
+        return;
+    }
+
+    // Values that were not yet added would otherwise be lost.
+    drain();
+
+    m_requestedCapacity = newCapacity;
+    m_buffer = std::make_shared<Buffer>(newCapacity);
+    Q_EMIT capacityChanged();
+}
+
+int StreamSource::maximumHistory() const
+{
+    return m_maximumHistory;
+}
+
+void StreamSource::setMaximumHistory(int newMaximumHistory)
+{
+    if (newMaximumHistory == m_maximumHistory) {
+        return;
+    }
+
+    m_maximumHistory = newMaximumHistory;
+    if (m_maximumHistory > 0 && m_values.size() > m_maximumHistory) {
+        m_values.remove(0, m_values.size() - m_maximumHistory);
+        m_minMaxValid = false;
+    }
+    Q_EMIT maximumHistoryChanged();
+}
+
+int StreamSource::interval() const
+{
+    return m_timer.interval();
+}
+
+void StreamSource::setInterval(int newInterval)
+{
+    if (newInterval == m_timer.interval()) {
+        return;
+    }
+
+    m_timer.setInterval(newInterval);
+    Q_EMIT intervalChanged();
+}
+
+int StreamSource::droppedCount() const
+{
+    return int(m_buffer->dropped.load(std::memory_order_relaxed));
+}
+
+void StreamSource::clear()
+{
+    m_values.clear();
+    m_minMaxValid = false;
+    Q_EMIT dataChanged();
+}
+
+int StreamSource::itemCount() const
+{
+    return m_values.size();
+}
+
+QVariant StreamSource::item(int index) const
+{
+    if (index < 0 || index >= m_values.size()) {
+        return QVariant{};
+    }
+
+    return m_values.at(index);
+}
+
+QVariant StreamSource::minimum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    updateMinMax();
+    return m_minimum;
+}
+
+QVariant StreamSource::maximum() const
+{
+    if (m_values.isEmpty()) {
+        return QVariant{};
+    }
+
+    updateMinMax();
+    return m_maximum;
+}
+
+void StreamSource::readValues(int start, int count, qreal *output) const
+{
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < m_values.size() ? m_values.at(index) : 0.0;
+    }
+}
+
+void StreamSource::drain()
+{
+    const auto tail = m_buffer->tail.load(std::memory_order_relaxed);
+    const auto head = m_buffer->head.load(std::memory_order_acquire);
+
+    if (head == tail) {
+        // Nothing can add values anymore once all producers are gone.
+        if (m_buffer.use_count() == 1) {
+            m_timer.stop();
+        }
+        return;
+    }
+
+    const auto count = int(head - tail);
+    const auto first = m_values.size();
+
+    for (auto index = tail; index != head; ++index) {
+        const auto value = m_buffer->values[index & m_buffer->mask];
+        m_values.append(value);
+        if (m_minMaxValid) {
+            m_minimum = std::min(m_minimum, value);
+            m_maximum = std::max(m_maximum, value);
+        }
+    }
+
+    m_buffer->tail.store(head, std::memory_order_release);
+
+    bool removed = false;
+    if (m_maximumHistory > 0 && m_values.size() > m_maximumHistory) {
+        m_values.remove(0, m_values.size() - m_maximumHistory);
+        m_minMaxValid = false;
+        removed = true;
+    }
+
+    if (!removed) {
+        Q_EMIT itemsAppended(first, count);
+    }
+    Q_EMIT dataChanged();
+}
+
+void StreamSource::updateMinMax() const
+{
+    if (m_minMaxValid) {
+        return;
+    }
+
+    const auto [minimum, maximum] = std::minmax_element(m_values.cbegin(), m_values.cend());
+    m_minimum = *minimum;
+    m_maximum = *maximum;
+    m_minMaxValid = true;
+}
+
+#include "moc_StreamSource.cpp"
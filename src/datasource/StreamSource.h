@@ -0,0 +1,238 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include <QList>
+#include <QTimer>
+#include <QVariant>
+
+/*!
+ * \qmltype StreamSource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A data source that receives values from a different thread.
+ *
+ * Values are added to this source from C++ using a StreamSource::Producer,
+ * which can be used from any single thread. There can only be one producer
+ * for a source at a time. Values are added to a fixed-size
+ * buffer without locking or allocating and are moved from that buffer to this
+ * source on the GUI thread every \l interval milliseconds, with a single
+ * change notification for all new values.
+ */
+class QUICKCHARTS_EXPORT StreamSource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    struct Buffer {
+        explicit Buffer(int capacity);
+
+        const quint64 capacity;
+        const quint64 mask;
+        std::unique_ptr<qreal[]> values;
+        alignas(64) std::atomic<quint64> head{0};
+        alignas(64) std::atomic<quint64> tail{0};
+        std::atomic<quint64> dropped{0};
+        // The buffer only supports a single producer, this is set while one
+        // exists.
+        std::atomic<bool> hasProducer{false};
+    };
+
+public:
+    /**
+     * A handle used to add values to a StreamSource.
+     *
+     * Only a single thread should add values using a producer at a time. A
+     * producer can be moved, but not copied, and only one producer exists
+     * for a source at a time. The producer remains safe to use after the
+     * source has been destroyed, values are then discarded.
+     */
+    class Producer
+    {
+    public:
+        Producer() = default;
+        Producer(const Producer &) = delete;
+        Producer(Producer &&other) = default;
+        ~Producer()
+        {
+            release();
+        }
+
+        Producer &operator=(const Producer &) = delete;
+        Producer &operator=(Producer &&other)
+        {
+            if (this != &other) {
+                release();
+                m_buffer = std::move(other.m_buffer);
+            }
+            return *this;
+        }
+
+        /**
+         * Whether this producer adds values to a source.
+         */
+        bool isValid() const
+        {
+            return bool(m_buffer);
+        }
+
+        /**
+         * Add a value.
+         *
+         * Returns false if the buffer is full, in which case the value is
+         * dropped.
+         */
+        bool push(qreal value)
+        {
+            if (!m_buffer) {
+                return false;
+            }
+
+            const auto head = m_buffer->head.load(std::memory_order_relaxed);
+            if (head - m_buffer->tail.load(std::memory_order_acquire) >= m_buffer->capacity) {
+                m_buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            m_buffer->values[head & m_buffer->mask] = value;
+            m_buffer->head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Add count values.
+         *
+         * Returns the number of values that were added, any values that did
+         * not fit in the buffer are dropped.
+         */
+        int push(const qreal *values, int count)
+        {
+            if (!m_buffer) {
+                return 0;
+            }
+
+            const auto head = m_buffer->head.load(std::memory_order_relaxed);
+            const auto available = m_buffer->capacity - (head - m_buffer->tail.load(std::memory_order_acquire));
+            const auto added = int(std::min<quint64>(available, quint64(std::max(count, 0))));
+
+            for (int i = 0; i < added; ++i) {
+                m_buffer->values[(head + i) & m_buffer->mask] = values[i];
+            }
+            m_buffer->head.store(head + added, std::memory_order_release);
+
+            if (added < count) {
+                m_buffer->dropped.fetch_add(count - added, std::memory_order_relaxed);
+            }
+            return added;
+        }
+
+    private:
+        friend class StreamSource;
+        explicit Producer(const std::shared_ptr<Buffer> &buffer)
+            : m_buffer(buffer)
+        {
+        }
+
+        void release()
+        {
+            if (m_buffer) {
+                m_buffer->hasProducer.store(false, std::memory_order_release);
+                m_buffer.reset();
+            }
+        }
+
+        std::shared_ptr<Buffer> m_buffer;
+    };
+
+    explicit StreamSource(QObject *parent = nullptr);
+
+    /**
+     * Create a producer for this source.
+     *
+     * The producer can be moved to a different thread and used there. The
+     * values are written to a buffer that only supports a single writer, so
+     * while a producer for this source exists, this returns an invalid
+     * producer that discards all values.
+     */
+    Producer producer();
+
+    /*!
+     * \qmlproperty int StreamSource::capacity
+     * \brief The maximum number of values that can be waiting to be added.
+     *
+     * This will be rounded up to a power of two. The default is 65536.
+     *
+     * \note Changing this property will disconnect any existing producers.
+     */
+    Q_PROPERTY(int capacity READ capacity WRITE setCapacity NOTIFY capacityChanged)
+    int capacity() const;
+    void setCapacity(int newCapacity);
+    Q_SIGNAL void capacityChanged();
+    /*!
+     * \qmlproperty int StreamSource::maximumHistory
+     * \brief The maximum number of values to keep.
+     *
+     * When more values than this have been added, the oldest values are
+     * discarded. If this is less than or equal to 0, all values are kept.
+     *
+     * The default is 0.
+     */
+    Q_PROPERTY(int maximumHistory READ maximumHistory WRITE setMaximumHistory NOTIFY maximumHistoryChanged)
+    int maximumHistory() const;
+    void setMaximumHistory(int newMaximumHistory);
+    Q_SIGNAL void maximumHistoryChanged();
+    /*!
+     * \qmlproperty int StreamSource::interval
+     * \brief The interval, in milliseconds, with which new values are added.
+     *
+     * The default is 16.
+     */
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    int interval() const;
+    void setInterval(int newInterval);
+    Q_SIGNAL void intervalChanged();
+    /*!
+     * \qmlproperty int StreamSource::droppedCount
+     * \brief The number of values that were dropped because the buffer was full.
+     */
+    Q_PROPERTY(int droppedCount READ droppedCount NOTIFY dataChanged)
+    int droppedCount() const;
+
+    /*!
+     * \qmlmethod StreamSource::clear
+     * \brief Remove all values from this source.
+     */
+    Q_INVOKABLE void clear();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    void drain();
+    void updateMinMax() const;
+
+    int m_maximumHistory = 0;
+    int m_requestedCapacity = 65536;
+    std::shared_ptr<Buffer> m_buffer;
+    QTimer m_timer;
+
+    QList<qreal> m_values;
+    mutable bool m_minMaxValid = false;
+    mutable qreal m_minimum = 0.0;
+    mutable qreal m_maximum = 0.0;
+};
@@ -0,0 +1,282 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#include "TransformProxySource.h"
+
+#include <algorithm>
+#include <limits>
+
+TransformProxySource::TransformProxySource(QObject *parent)
+    : ChartDataSource(parent)
+{
+}
+
+QQmlListProperty<ChartDataSource> TransformProxySource::sourcesProperty()
+{
+    return QQmlListProperty<ChartDataSource>{
+        this,
+        this,
+        &TransformProxySource::appendSource,
+        &TransformProxySource::sourceCount,
+        &TransformProxySource::source,
+        &TransformProxySource::clearSources,
+    };
+}
+
+QList<ChartDataSource *> TransformProxySource::sources() const
+{
+    return m_sources;
+}
+
+void TransformProxySource::setSources(const QList<ChartDataSource *> &newSources)
+{
+    if (newSources == m_sources) {
+        return;
+    }
+
+    for (auto source : std::as_const(m_sources)) {
+        source->disconnect(this);
+    }
+
+    m_sources.clear();
+    for (auto source : newSources) {
+        connectSource(source);
+    }
+
+    invalidate();
+    Q_EMIT sourcesChanged();
+}
+
+TransformProxySource::Operation TransformProxySource::operation() const
+{
+    return m_operation;
+}
+
+void TransformProxySource::setOperation(Operation newOperation)
+{
+    if (newOperation == m_operation) {
+        return;
+    }
+
+    m_operation = newOperation;
+    invalidate();
+    Q_EMIT operationChanged();
+}
+
+int TransformProxySource::itemCount() const
+{
+    return calculateItemCount();
+}
+
+QVariant TransformProxySource::item(int index) const
+{
+    if (index < 0 || index >= itemCount()) {
+        return QVariant{};
+    }
+
+    update();
+    return m_values.at(index);
+}
+
+QVariant TransformProxySource::minimum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    update();
+    return m_minimum;
+}
+
+QVariant TransformProxySource::maximum() const
+{
+    if (itemCount() == 0) {
+        return QVariant{};
+    }
+
+    update();
+    return m_maximum;
+}
+
+void TransformProxySource::readValues(int start, int count, qreal *output) const
+{
+    update();
+
+    for (int i = 0; i < count; ++i) {
+        const auto index = start + i;
+        output[i] = index >= 0 && index < m_values.size() ? m_values.at(index) : 0.0;
+    }
+}
+
+void TransformProxySource::appendSource(QQmlListProperty<ChartDataSource> *list, ChartDataSource *source)
+{
+    auto proxy = reinterpret_cast<TransformProxySource *>(list->data);
+    proxy->connectSource(source);
+    proxy->invalidate();
+    Q_EMIT proxy->sourcesChanged();
+}
+
+qsizetype TransformProxySource::sourceCount(QQmlListProperty<ChartDataSource> *list)
+{
+    return reinterpret_cast<TransformProxySource *>(list->data)->m_sources.size();
+}
+
+ChartDataSource *TransformProxySource::source(QQmlListProperty<ChartDataSource> *list, qsizetype index)
+{
+    return reinterpret_cast<TransformProxySource *>(list->data)->m_sources.at(index);
+}
+
+void TransformProxySource::clearSources(QQmlListProperty<ChartDataSource> *list)
+{
+    reinterpret_cast<TransformProxySource *>(list->data)->setSources({});
+}
+
+void TransformProxySource::connectSource(ChartDataSource *source)
+{
+    if (!source) {
+        return;
+    }
+
+    m_sources.append(source);
+
+    connect(source, &ChartDataSource::itemsAppended, this, [this](int first) {
+        m_appendedFirst = first;
+    });
+    connect(source, &ChartDataSource::dataChanged, this, [this]() {
+        // Items before the appended items did not change.
+        const auto first = std::max(m_appendedFirst, 0);
+        m_appendedFirst = -1;
+        m_validCount = std::min(m_validCount, first);
+
+        const auto previousCount = m_itemCount;
+        m_itemCount = calculateItemCount();
+        if (first >= previousCount && m_itemCount > previousCount) {
+            Q_EMIT itemsAppended(previousCount, m_itemCount - previousCount);
+        }
+        Q_EMIT dataChanged();
+    });
+    connect(source, &QObject::destroyed, this, &TransformProxySource::removeSource);
+}
+
+void TransformProxySource::removeSource(QObject *source)
+{
+    m_sources.removeIf([source](ChartDataSource *entry) {
+        return entry == source;
+    });
+    invalidate();
+    Q_EMIT sourcesChanged();
+}
+
+void TransformProxySource::invalidate()
+{
+    m_validCount = 0;
+    m_itemCount = calculateItemCount();
+    Q_EMIT dataChanged();
+}
+
+void TransformProxySource::update() const
+{
+    const auto count = calculateItemCount();
+    m_values.resize(count);
+
+    if (m_validCount >= count) {
+        m_validCount = count;
+        return;
+    }
+
+    const auto first = m_validCount;
+    const auto size = count - first;
+    auto output = m_values.data() + first;
+
+    // Each source is read in bulk and combined with the values so far in a
+    // single pass, rather than reading every item of every source separately.
+    m_sources.first()->readValues(first, size, output);
+
+    QList<qreal> buffer(size);
+    QList<qreal> total;
+    if (m_operation == Fraction) {
+        total = QList<qreal>(output, output + size);
+    }
+
+    for (auto source : m_sources.sliced(1)) {
+        source->readValues(first, size, buffer.data());
+        const auto input = buffer.constData();
+
+        switch (m_operation) {
+        case Sum:
+        case Average:
+            for (int i = 0; i < size; ++i) {
+                output[i] += input[i];
+            }
+            break;
+        case Difference:
+            for (int i = 0; i < size; ++i) {
+                output[i] -= input[i];
+            }
+            break;
+        case Product:
+            for (int i = 0; i < size; ++i) {
+                output[i] *= input[i];
+            }
+            break;
+        case Quotient:
+            for (int i = 0; i < size; ++i) {
+                output[i] = input[i] != 0.0 ? output[i] / input[i] : 0.0;
+            }
+            break;
+        case Fraction:
+            for (int i = 0; i < size; ++i) {
+                total[i] += input[i];
+            }
+            break;
+        case Minimum:
+            for (int i = 0; i < size; ++i) {
+                output[i] = std::min(output[i], input[i]);
+            }
+            break;
+        case Maximum:
+            for (int i = 0; i < size; ++i) {
+                output[i] = std::max(output[i], input[i]);
+            }
+            break;
+        }
+    }
+
+    if (m_operation == Average) {
+        const auto sourceCount = qreal(m_sources.size());
+        for (int i = 0; i < size; ++i) {
+            output[i] /= sourceCount;
+        }
+    } else if (m_operation == Fraction) {
+        for (int i = 0; i < size; ++i) {
+            output[i] = total[i] != 0.0 ? output[i] / total[i] : 0.0;
+        }
+    }
+
+    // Values before first did not change, so only the new values need to be
+    // included in minimum and maximum.
+    const auto [minimum, maximum] = std::minmax_element(output, output + size);
+    m_minimum = first > 0 ? std::min(m_minimum, *minimum) : *minimum;
+    m_maximum = first > 0 ? std::max(m_maximum, *maximum) : *maximum;
+
+    m_validCount = count;
+}
+
+int TransformProxySource::calculateItemCount() const
+{
+    if (m_sources.isEmpty()) {
+        return 0;
+    }
+
+    auto result = std::numeric_limits<int>::max();
+    for (auto source : m_sources) {
+        result = std::min(result, source->itemCount());
+    }
+    return result;
+}
+
+#include "moc_TransformProxySource.cpp"
@@ -0,0 +1,131 @@
+/*
+ * This file is part of KQuickCharts
+ * SPDX-FileCopyrightText: 2026 Arjen Hiemstra <ahiemstra@heimr.nl>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+ */
+
+#pragma once
+
+#include "ChartDataSource.h"
+
+#include <QList>
+#include <QQmlListProperty>
+#include <QVariant>
+
+/*!
+ * \qmltype TransformProxySource
+ * \inherits ChartDataSource
+ * \inqmlmodule org.kde.quickcharts
+ *
+ * \brief A source that combines the items of several other sources.
+ *
+ * This source applies \l operation to the items with the same index of all
+ * sources in \l sources. For example, to display the difference between two
+ * sources:
+ *
+ * \qml
+ * TransformProxySource {
+ *     sources: [firstSource, secondSource]
+ *     operation: TransformProxySource.Difference
+ * }
+ * \endqml
+ *
+ * The number of items is that of the source with the fewest items. Values are
+ * only calculated when they are accessed after a source changed. If sources
+ * emit itemsAppended, only new items are calculated.
+ */
+class QUICKCHARTS_EXPORT TransformProxySource : public ChartDataSource
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+public:
+    /*!
+     * \enum TransformProxySource::Operation
+     *
+     * How the items of the sources are combined.
+     *
+     * \value Sum
+     *        Add the values of all sources.
+     * \value Difference
+     *        Subtract the values of all other sources from the first source.
+     * \value Product
+     *        Multiply the values of all sources.
+     * \value Quotient
+     *        Divide the value of the first source by the values of all other
+     *        sources. Dividing by zero results in zero.
+     * \value Fraction
+     *        Divide the value of the first source by the sum of the values of
+     *        all sources. If the sum is zero, this results in zero.
+     * \value Minimum
+     *        Use the smallest value of all sources.
+     * \value Maximum
+     *        Use the largest value of all sources.
+     * \value Average
+     *        Use the average of the values of all sources.
+     */
+    enum Operation {
+        Sum,
+        Difference,
+        Product,
+        Quotient,
+        Fraction,
+        Minimum,
+        Maximum,
+        Average,
+    };
+    Q_ENUM(Operation)
+
+    explicit TransformProxySource(QObject *parent = nullptr);
+
+    /*!
+     * \qmlproperty list<ChartDataSource> TransformProxySource::sources
+     * \brief The sources to combine.
+     */
+    Q_PROPERTY(QQmlListProperty<ChartDataSource> sources READ sourcesProperty NOTIFY sourcesChanged)
+    QQmlListProperty<ChartDataSource> sourcesProperty();
+    QList<ChartDataSource *> sources() const;
+    void setSources(const QList<ChartDataSource *> &newSources);
+    Q_SIGNAL void sourcesChanged();
+    /*!
+     * \qmlproperty enumeration TransformProxySource::operation
+     * \qmlenumeratorsfrom TransformProxySource::Operation
+     * \brief How the items of the sources are combined.
+     *
+     * The default is TransformProxySource.Sum.
+     */
+    Q_PROPERTY(Operation operation READ operation WRITE setOperation NOTIFY operationChanged)
+    Operation operation() const;
+    void setOperation(Operation newOperation);
+    Q_SIGNAL void operationChanged();
+
+    int itemCount() const override;
+    QVariant item(int index) const override;
+    QVariant minimum() const override;
+    QVariant maximum() const override;
+    void readValues(int start, int count, qreal *output) const override;
+
+private:
+    static void appendSource(QQmlListProperty<ChartDataSource> *list, ChartDataSource *source);
+    static qsizetype sourceCount(QQmlListProperty<ChartDataSource> *list);
+    static ChartDataSource *source(QQmlListProperty<ChartDataSource> *list, qsizetype index);
+    static void clearSources(QQmlListProperty<ChartDataSource> *list);
+
+    void connectSource(ChartDataSource *source);
+    void removeSource(QObject *source);
+    void invalidate();
+    void update() const;
+    int calculateItemCount() const;
+
+    QList<ChartDataSource *> m_sources;
+    Operation m_operation = Sum;
+
+    // Values before m_validCount do not need to be recalculated.
+    mutable QList<qreal> m_values;
+    mutable int m_validCount = 0;
+    mutable qreal m_minimum = 0.0;
+    mutable qreal m_maximum = 0.0;
+    int m_itemCount = 0;
+    int m_appendedFirst = -1;
+};
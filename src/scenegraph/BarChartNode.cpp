@@ -6,6 +6,8 @@
 
 #include "BarChartNode.h"
 
+#include <algorithm>
+
 #include <QDebug>
 
 #include "BarChartMaterial.h"
@@ -126,7 +128,11 @@ void BarChartNode::update()
     for (auto index = 0; index < m_bars.count(); ++index) {
         auto entry = m_bars.at(index);
 
-        auto rect = QRectF{QPointF{entry.x, m_rect.top()}, QSizeF{entry.width, m_rect.height()}};
+        // Bars that do not start at the bottom of the chart get a rect that
+        // ends at their base, so the value needs to be relative to that rect.
+        const auto base = std::clamp(entry.base, 0.0f, 1.0f);
+        auto rect = QRectF{QPointF{entry.x, m_rect.top()}, QSizeF{entry.width, std::max(m_rect.height() * (1.0 - base), 1.0)}};
+        const float value = (entry.value - base) * (m_rect.height() / rect.height());
 
         if (childCount() <= index) {
             appendChildNode(new BarNode{rect});
@@ -153,9 +159,9 @@ void BarChartNode::update()
             child->markDirty(QSGNode::DirtyMaterial);
         }
 
-        if (child->rect != rect || !qFuzzyCompare(child->value, entry.value) || child->color != entry.color) {
+        if (child->rect != rect || !qFuzzyCompare(child->value, value) || child->color != entry.color) {
             child->rect = rect;
-            child->value = entry.value;
+            child->value = value;
             child->color = entry.color;
             child->update();
         }
@@ -15,6 +15,8 @@ struct Bar {
     float width;
     float value;
     QColor color;
+    // Where the bar starts, relative to the chart height.
+    float base = 0.0;
 };
 
 class BarChartNode : public QSGNode